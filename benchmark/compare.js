@@ -0,0 +1,42 @@
+import { readFileSync } from 'node:fs'
+
+// Compare two outputs of `npm run benchmark -- --json`, for example of
+// different commits, and print how much each result changed
+const [baselineFile, currentFile] = process.argv.slice(2)
+
+if (!baselineFile || !currentFile) {
+  console.error('Usage: node benchmark/compare.js <baseline.json> <current.json>')
+  process.exit(1)
+}
+
+const baseline = JSON.parse(readFileSync(baselineFile, 'utf8'))
+const current = JSON.parse(readFileSync(currentFile, 'utf8'))
+const previous = new Map(baseline.results.map((result) => [result.name, result]))
+
+console.log(`${label(baseline)} -> ${label(current)}\n`)
+
+for (const result of current.results) {
+  const before = previous.get(result.name)
+
+  if (!before) {
+    console.log(`${result.name.padEnd(32)} (new)`)
+    continue
+  }
+
+  // Compare the median of latency percentiles
+  const key = 'value' in result ? 'value' : 'p50'
+  const change = (result[key] - before[key]) / before[key] * 100
+  const improved = result.better === 'higher' ? change > 0 : change < 0
+  const sign = change > 0 ? '+' : ''
+
+  console.log([
+    result.name.padEnd(32),
+    `${before[key]} -> ${result[key]} ${result.unit}`.padEnd(36),
+    `${sign}${change.toFixed(1)}%`.padStart(8),
+    Math.abs(change) < 5 ? '' : improved ? 'faster' : 'slower'
+  ].join(' '))
+}
+
+function label (output) {
+  return `${(output.commit ?? 'unknown').slice(0, 8)} (node ${output.node}, ${output.platform})`
+}
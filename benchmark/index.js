@@ -0,0 +1,243 @@
+import { readFileSync } from 'node:fs'
+import { availableParallelism } from 'node:os'
+import { execFileSync } from 'node:child_process'
+import { parseArgs } from 'node:util'
+import { Hunspell } from '../index.js'
+
+const { values: args } = parseArgs({
+  options: {
+    json: { type: 'boolean', default: false },
+    filter: { type: 'string', default: '' },
+    time: { type: 'string', default: '1000' },
+    runs: { type: 'string', default: '5' },
+    'max-callers': { type: 'string', default: String(Math.min(availableParallelism(), 16)) },
+    'thread-pool': { type: 'string' }
+  }
+})
+
+const time = Number(args.time)
+const runs = Number(args.runs)
+const maxCallers = Number(args['max-callers'])
+
+const dictionaries = {
+  en_us: { aff: 'test/dictionaries/en_us.aff', dic: 'test/dictionaries/en_us.dic' },
+  en_gb: { aff: 'test/dictionaries/en_gb.aff', dic: 'test/dictionaries/en_gb.dic' },
+  nl: { aff: 'test/dictionaries/nl.aff', dic: 'test/dictionaries/nl.dic' }
+}
+
+// Has no affix file of its own, so is only benchmarked with addDictionary()
+const fr = 'test/dictionaries/fr.dic'
+
+const results = []
+
+if (args['thread-pool'] !== undefined) {
+  Hunspell.setThreadPoolSize(Number(args['thread-pool']))
+}
+
+for (const [language, dictionary] of Object.entries(dictionaries)) {
+  await bench(`load/sync/${language}`, 'ms', 'lower', () => {
+    return median(repeat(runs, () => elapsed(() => new Hunspell(dictionary))))
+  })
+
+  await bench(`load/async/${language}`, 'ms', 'lower', async () => {
+    const durations = []
+
+    for (let i = 0; i < runs; i++) {
+      const start = now()
+      await Hunspell.load(dictionary)
+      durations.push(now() - start)
+    }
+
+    return median(durations)
+  })
+}
+
+await bench('load/addDictionary/fr', 'ms', 'lower', () => {
+  return median(repeat(runs, () => {
+    const hunspell = new Hunspell(dictionaries.en_us)
+    return elapsed(() => hunspell.addDictionarySync(fr))
+  }))
+})
+
+for (const [language, dictionary] of Object.entries(dictionaries)) {
+  const hunspell = new Hunspell(dictionary)
+  const stored = new Hunspell(dictionary, { wordStore: true })
+  const { correct, incorrect } = sample(hunspell, dictionary.dic)
+
+  for (const [kind, words] of [['correct', correct], ['incorrect', incorrect]]) {
+    await bench(`spell/sync/${kind}/${language}`, 'ops/s', 'higher', () => {
+      return throughput(words, (word) => hunspell.spellSync(word))
+    })
+
+    await bench(`spell/batch/${kind}/${language}`, 'ops/s', 'higher', () => {
+      return throughput([words], (batch) => hunspell.spellBatchSync(batch)) * words.length
+    })
+
+    await bench(`spell/wordStore/${kind}/${language}`, 'ops/s', 'higher', () => {
+      return throughput(words, (word) => stored.spellSync(word))
+    })
+  }
+
+  await bench(`suggest/latency/${language}`, 'ms', 'lower', async () => {
+    const durations = []
+    const deadline = now() + time
+
+    for (let i = 0; i < incorrect.length && (now() < deadline || durations.length < 20); i++) {
+      const start = now()
+      await hunspell.suggest(incorrect[i])
+      durations.push(now() - start)
+    }
+
+    return percentiles(durations)
+  })
+}
+
+{
+  const hunspell = new Hunspell(dictionaries.en_us)
+  const { correct, incorrect } = sample(hunspell, dictionaries.en_us.dic)
+
+  // Per call, so the difference is the cost of going through the threadpool
+  await bench('overhead/sync/spell', 'us', 'lower', () => {
+    return 1e6 / throughput(correct, (word) => hunspell.spellSync(word))
+  })
+
+  await bench('overhead/async/spell', 'us', 'lower', async () => {
+    return 1e6 / await concurrently(1, correct, (word) => hunspell.spell(word))
+  })
+
+  for (let callers = 1; callers <= maxCallers; callers *= 2) {
+    const concurrent = new Hunspell(dictionaries.en_us, { concurrency: callers })
+
+    await bench(`scaling/spell/${callers}`, 'ops/s', 'higher', () => {
+      return concurrently(callers, correct, (word) => concurrent.spell(word))
+    })
+
+    await bench(`scaling/suggest/${callers}`, 'ops/s', 'higher', () => {
+      return concurrently(callers, incorrect, (word) => concurrent.suggest(word))
+    })
+  }
+}
+
+if (args.json) {
+  console.log(JSON.stringify({
+    commit: commit(),
+    node: process.version,
+    platform: `${process.platform}-${process.arch}`,
+    cpus: availableParallelism(),
+    date: new Date().toISOString(),
+    options: { time, runs, maxCallers, threadPool: args['thread-pool'] ?? null },
+    results
+  }, null, 2))
+}
+
+async function bench (name, unit, better, fn) {
+  if (args.filter && !name.includes(args.filter)) {
+    return
+  }
+
+  const value = await fn()
+  const values = typeof value === 'number' ? { value: round(value) } : value
+
+  results.push({ name, unit, better, ...values })
+
+  if (!args.json) {
+    const formatted = Object.entries(values).map(([k, v]) => `${k}=${v}`).join(' ')
+    console.log(`${name.padEnd(32)} ${formatted} ${unit}`)
+  }
+}
+
+// Dictionary words that are correct, and misspellings of them made by
+// swapping two characters, the same ones on every run
+function sample (hunspell, file, size = 2000) {
+  const lines = readFileSync(file, 'utf8').split('\n').slice(1)
+  const step = Math.max(1, Math.floor(lines.length / size))
+  const correct = []
+  const incorrect = []
+
+  for (let i = 0; i < lines.length && correct.length < size; i += step) {
+    const word = lines[i].split('/')[0].trim()
+
+    if (word && !/\s/.test(word) && hunspell.spellSync(word)) {
+      correct.push(word)
+
+      if (word.length >= 4) {
+        const j = Math.floor(word.length / 2)
+        const misspelling = word.slice(0, j - 1) + word[j] + word[j - 1] + word.slice(j + 1)
+
+        if (!hunspell.spellSync(misspelling)) {
+          incorrect.push(misspelling)
+        }
+      }
+    }
+  }
+
+  return { correct, incorrect }
+}
+
+// Calls per second of a synchronous function, cycling through inputs
+function throughput (inputs, fn) {
+  const deadline = now() + time
+  const start = now()
+  let calls = 0
+
+  while (now() < deadline) {
+    for (let i = 0; i < 100; i++) {
+      fn(inputs[calls++ % inputs.length])
+    }
+  }
+
+  return calls / (now() - start) * 1e3
+}
+
+// Calls per second of an asynchronous function, by this many callers that
+// each wait for one call before making the next
+async function concurrently (callers, inputs, fn) {
+  const deadline = now() + time
+  const start = now()
+  let calls = 0
+
+  await Promise.all(Array.from({ length: callers }, async () => {
+    while (now() < deadline) {
+      await fn(inputs[calls++ % inputs.length])
+    }
+  }))
+
+  return calls / (now() - start) * 1e3
+}
+
+function percentiles (values) {
+  const sorted = values.slice().sort((a, b) => a - b)
+  const at = (p) => round(sorted[Math.min(sorted.length - 1, Math.floor(p * sorted.length))])
+
+  return { count: sorted.length, p50: at(0.5), p90: at(0.9), p99: at(0.99), max: at(1) }
+}
+
+function median (values) {
+  return percentiles(values).p50
+}
+
+function repeat (n, fn) {
+  return Array.from({ length: n }, fn)
+}
+
+function elapsed (fn) {
+  const start = now()
+  fn()
+  return now() - start
+}
+
+function now () {
+  return performance.now()
+}
+
+function round (value) {
+  return Math.round(value * 1e3) / 1e3
+}
+
+function commit () {
+  try {
+    return execFileSync('git', ['rev-parse', 'HEAD'], { encoding: 'utf8' }).trim()
+  } catch {
+    return null
+  }
+}
@@ -56,12 +56,18 @@
     "sources": [
       "src/hunspell/src/hunspell/affentry.cxx",
       "src/hunspell/src/hunspell/affentry.hxx",
+      "src/hunspell/src/hunspell/affixindex.hxx",
       "src/hunspell/src/hunspell/affixmgr.cxx",
       "src/hunspell/src/hunspell/affixmgr.hxx",
+      "src/hunspell/src/hunspell/arena.hxx",
       "src/hunspell/src/hunspell/atypes.hxx",
       "src/hunspell/src/hunspell/baseaffix.hxx",
       "src/hunspell/src/hunspell/csutil.cxx",
       "src/hunspell/src/hunspell/csutil.hxx",
+      "src/hunspell/src/hunspell/dicfile.cxx",
+      "src/hunspell/src/hunspell/dicfile.hxx",
+      "src/hunspell/src/hunspell/dicloader.cxx",
+      "src/hunspell/src/hunspell/dicloader.hxx",
       "src/hunspell/src/hunspell/filemgr.cxx",
       "src/hunspell/src/hunspell/filemgr.hxx",
       "src/hunspell/src/hunspell/hashmgr.cxx",
@@ -73,10 +79,14 @@
       "src/hunspell/src/hunspell/hunzip.cxx",
       "src/hunspell/src/hunspell/hunzip.hxx",
       "src/hunspell/src/hunspell/langnum.hxx",
+      "src/hunspell/src/hunspell/memfile.cxx",
+      "src/hunspell/src/hunspell/memfile.hxx",
       "src/hunspell/src/hunspell/phonet.cxx",
       "src/hunspell/src/hunspell/phonet.hxx",
       "src/hunspell/src/hunspell/replist.cxx",
       "src/hunspell/src/hunspell/replist.hxx",
+      "src/hunspell/src/hunspell/simdscore.cxx",
+      "src/hunspell/src/hunspell/simdscore.hxx",
       "src/hunspell/src/hunspell/suggestmgr.cxx",
       "src/hunspell/src/hunspell/suggestmgr.hxx",
       "src/hunspell/src/hunspell/utf_info.hxx",
@@ -90,7 +100,25 @@
         "action_name": "apply_patch",
         "inputs": [
           "patches/001-static-cast.patch",
-          "src/hunspell/src/hunspell/affixmgr.cxx"
+          "patches/002-memory-files.patch",
+          "patches/003-shared-dictionaries.patch",
+          "patches/004-compiled-dictionaries.patch",
+          "patches/005-suggest-interrupt.patch",
+          "patches/006-simd-scoring.patch",
+          "patches/007-dictionary-arena.patch",
+          "patches/008-parallel-dic-loading.patch",
+          "patches/009-flat-affix-tables.patch",
+          "scripts/patches.js",
+          "src/hunspell/src/hunspell/affixmgr.cxx",
+          "src/hunspell/src/hunspell/affixmgr.hxx",
+          "src/hunspell/src/hunspell/filemgr.cxx",
+          "src/hunspell/src/hunspell/filemgr.hxx",
+          "src/hunspell/src/hunspell/hashmgr.cxx",
+          "src/hunspell/src/hunspell/hashmgr.hxx",
+          "src/hunspell/src/hunspell/hunspell.cxx",
+          "src/hunspell/src/hunspell/hunspell.hxx",
+          "src/hunspell/src/hunspell/suggestmgr.cxx",
+          "src/hunspell/src/hunspell/suggestmgr.hxx"
         ],
         "outputs": [
           "<(SHARED_INTERMEDIATE_DIR)/patch-applied.stamp"
@@ -111,7 +139,17 @@
         "action_name": "revert_patch",
         "inputs": [
           "<(SHARED_INTERMEDIATE_DIR)/patch-applied.stamp",
-          "src/hunspell/src/hunspell/affixmgr.cxx"
+          "scripts/patches.js",
+          "src/hunspell/src/hunspell/affixmgr.cxx",
+          "src/hunspell/src/hunspell/affixmgr.hxx",
+          "src/hunspell/src/hunspell/filemgr.cxx",
+          "src/hunspell/src/hunspell/filemgr.hxx",
+          "src/hunspell/src/hunspell/hashmgr.cxx",
+          "src/hunspell/src/hunspell/hashmgr.hxx",
+          "src/hunspell/src/hunspell/hunspell.cxx",
+          "src/hunspell/src/hunspell/hunspell.hxx",
+          "src/hunspell/src/hunspell/suggestmgr.cxx",
+          "src/hunspell/src/hunspell/suggestmgr.hxx"
         ],
         "outputs": [
           "<(SHARED_INTERMEDIATE_DIR)/patch-reverted.stamp"
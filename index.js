@@ -1,7 +1,273 @@
 import { createRequire } from 'module'
+import { Transform } from 'node:stream'
 
 // https://nodejs.org/api/esm.html#no-addon-loading
 const __require = createRequire(import.meta.url)
 const Hunspell = __require('node-gyp-build')(import.meta.dirname)
 
+// ASCII whitespace, where a batch can be cut without splitting a word
+const SEPARATORS = [0x20, 0x0a, 0x0d, 0x09]
+
+class CheckStream extends Transform {
+  constructor (hunspell, options) {
+    options = options ?? {}
+
+    const batchSize = options.batchSize ?? 64 * 1024
+    const maxInFlight = options.maxInFlight ?? 4
+
+    if (!Number.isInteger(batchSize) || batchSize < 1) {
+      throw new TypeError('The "batchSize" option must be a positive integer')
+    } else if (!Number.isInteger(maxInFlight) || maxInFlight < 1) {
+      throw new TypeError('The "maxInFlight" option must be a positive integer')
+    }
+
+    super({ readableObjectMode: true })
+
+    this._hunspell = hunspell
+    this._batchSize = batchSize
+    this._maxInFlight = maxInFlight
+    this._controller = new AbortController()
+    this._checkOptions = { wordCharacters: options.wordCharacters, signal: this._controller.signal }
+
+    // Input that hasn't been checked yet, starting at byte this._offset
+    this._pending = []
+    this._pendingLength = 0
+    this._offset = 0
+
+    // Batches being checked, in order of input
+    this._inFlight = []
+    this._waiting = null
+    this._flushing = false
+  }
+
+  _transform (chunk, encoding, callback) {
+    this._pending.push(chunk)
+    this._pendingLength += chunk.length
+
+    if (this._pendingLength < this._batchSize) {
+      return callback()
+    }
+
+    const buffer = Buffer.concat(this._pending, this._pendingLength)
+    const end = cut(buffer)
+
+    this._pending = end < buffer.length ? [buffer.subarray(end)] : []
+    this._pendingLength = buffer.length - end
+    this._check(buffer.subarray(0, end))
+
+    // Accept more input unless too many batches are in flight
+    if (this._inFlight.length < this._maxInFlight) {
+      callback()
+    } else {
+      this._waiting = callback
+    }
+  }
+
+  _flush (callback) {
+    this._flushing = true
+
+    if (this._pendingLength > 0) {
+      this._check(Buffer.concat(this._pending, this._pendingLength))
+      this._pending = []
+      this._pendingLength = 0
+    }
+
+    if (this._inFlight.length === 0) {
+      callback()
+    } else {
+      this._waiting = callback
+    }
+  }
+
+  _destroy (err, callback) {
+    this._controller.abort()
+    this._inFlight = []
+    this._waiting = null
+    callback(err)
+  }
+
+  _check (batch) {
+    const entry = { batch, offset: this._offset, ranges: null, error: null, done: false }
+
+    this._offset += batch.length
+    this._inFlight.push(entry)
+
+    this._hunspell.checkText(batch, this._checkOptions).then((ranges) => {
+      entry.ranges = ranges
+    }, (err) => {
+      entry.error = err
+    }).then(() => {
+      entry.done = true
+      this._emitReady()
+    })
+  }
+
+  // Emit misspellings of finished batches, keeping them in order of input
+  _emitReady () {
+    while (this._inFlight.length > 0 && this._inFlight[0].done) {
+      const { batch, offset, ranges, error } = this._inFlight.shift()
+
+      if (this.destroyed) {
+        return
+      } else if (error) {
+        return this.destroy(error)
+      }
+
+      for (let i = 0; i < ranges.length; i += 2) {
+        const start = ranges[i]
+        const length = ranges[i + 1]
+
+        this.push({
+          word: batch.toString('utf8', start, start + length),
+          offset: offset + start,
+          length
+        })
+      }
+    }
+
+    // When flushing, wait for all batches
+    const limit = this._flushing ? 1 : this._maxInFlight
+
+    if (this._waiting !== null && this._inFlight.length < limit) {
+      const callback = this._waiting
+
+      this._waiting = null
+      callback()
+    }
+  }
+}
+
+// Find where to cut a batch: after the last separator, or if there's none,
+// at the end, taking care not to split a UTF-8 encoded character
+function cut (buffer) {
+  let end = -1
+
+  for (const separator of SEPARATORS) {
+    end = Math.max(end, buffer.lastIndexOf(separator))
+  }
+
+  if (end >= 0) {
+    return end + 1
+  }
+
+  let start = buffer.length - 1
+
+  while (start > 0 && (buffer[start] & 0xc0) === 0x80) {
+    start--
+  }
+
+  const lead = buffer[start]
+  const size = lead >= 0xf0 ? 4 : lead >= 0xe0 ? 3 : lead >= 0xc0 ? 2 : 1
+
+  return start > 0 && start + size > buffer.length ? start : buffer.length
+}
+
+// Results of a batch method, which the addon returns packed as one buffer
+// of strings. Decoded on access, and only once per unique word.
+class BatchResults {
+  constructor (packed) {
+    this._packed = packed
+    this._decoded = new Array(packed.groups.length - 1)
+    this.length = packed.indices.length
+    this.timedOut = packed.timedOut !== undefined && packed.timedOut.includes(1)
+  }
+
+  at (index) {
+    index = Math.trunc(index) || 0
+    if (index < 0) index += this.length
+    if (!(index >= 0 && index < this.length)) return undefined
+
+    const unique = this._packed.indices[index]
+
+    if (this._decoded[unique] === undefined) {
+      this._decoded[unique] = this._decode(unique)
+    }
+
+    return this._decoded[unique]
+  }
+
+  toArray () {
+    return Array.from(this)
+  }
+
+  * [Symbol.iterator] () {
+    for (let i = 0; i < this.length; i++) {
+      yield this.at(i)
+    }
+  }
+
+  _decode (unique) {
+    const { data, offsets, groups, correct, timedOut } = this._packed
+
+    if (correct !== undefined && correct[unique] === 1) {
+      return null
+    }
+
+    const strings = []
+
+    for (let i = groups[unique]; i < groups[unique + 1]; i++) {
+      strings.push(data.toString('utf8', offsets[i], offsets[i + 1]))
+    }
+
+    if (timedOut !== undefined && timedOut[unique] === 1) {
+      strings.timedOut = true
+    }
+
+    return strings
+  }
+}
+
+// Results of a single word, which the addon returns packed like those of a
+// batch: null for a correct word, or an array of strings.
+function unpack (packed) {
+  if (packed === null) {
+    return null
+  }
+
+  const { data, offsets } = packed
+  const strings = new Array(offsets.length - 1)
+
+  for (let i = 0; i < strings.length; i++) {
+    strings[i] = data.toString('utf8', offsets[i], offsets[i + 1])
+  }
+
+  if (packed.timedOut) {
+    strings.timedOut = true
+  }
+
+  return strings
+}
+
+Hunspell.prototype.createCheckStream = function (options) {
+  return new CheckStream(this, options)
+}
+
+// Wrap the results of the addon's batch methods
+for (const method of ['suggestBatch', 'stemBatch', 'analyzeBatch']) {
+  const batch = Hunspell.prototype[method]
+  const batchSync = Hunspell.prototype[method + 'Sync']
+
+  Hunspell.prototype[method] = async function (...args) {
+    return new BatchResults(await batch.apply(this, args))
+  }
+
+  Hunspell.prototype[method + 'Sync'] = function (...args) {
+    return new BatchResults(batchSync.apply(this, args))
+  }
+}
+
+// Unpack the results of the addon's single word methods
+for (const method of ['suggest', 'stem', 'analyze', 'generate']) {
+  const single = Hunspell.prototype[method]
+  const singleSync = Hunspell.prototype[method + 'Sync']
+
+  Hunspell.prototype[method] = async function (...args) {
+    return unpack(await single.apply(this, args))
+  }
+
+  Hunspell.prototype[method + 'Sync'] = function (...args) {
+    return unpack(singleSync.apply(this, args))
+  }
+}
+
 export { Hunspell }
@@ -0,0 +1,54 @@
+import { execFileSync } from 'node:child_process'
+import { readdirSync, readFileSync, rmSync } from 'node:fs'
+import path from 'node:path'
+
+const project = path.dirname(import.meta.dirname)
+const patches = path.join(project, 'patches')
+
+export const submodule = path.join(project, 'src/hunspell')
+
+// In the order they must be applied
+export function patchFiles () {
+  return readdirSync(patches)
+    .filter((name) => name.endsWith('.patch'))
+    .sort()
+    .map((name) => path.join(patches, name))
+}
+
+// Restore the files of the submodule that the patches modify, and remove
+// the files they add. Requires the submodule's repo.
+export function restore () {
+  const modified = new Set()
+  const added = new Set()
+
+  for (const patchFile of patchFiles()) {
+    let file = null
+
+    for (const line of readFileSync(patchFile, 'utf8').split('\n')) {
+      const match = /^diff --git a\/(\S+) b\/\S+$/.exec(line)
+
+      if (match) {
+        file = match[1]
+
+        // Unless an earlier patch added it
+        if (!added.has(file)) {
+          modified.add(file)
+        }
+      } else if (file && line.startsWith('new file mode')) {
+        modified.delete(file)
+        added.add(file)
+      }
+    }
+  }
+
+  for (const file of added) {
+    rmSync(path.join(submodule, file), { force: true })
+  }
+
+  if (modified.size > 0) {
+    execFileSync('git', ['checkout', '--', ...modified], {
+      cwd: submodule,
+      stdio: 'inherit'
+    })
+  }
+}
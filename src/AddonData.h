@@ -0,0 +1,52 @@
+#ifndef AddonData_H
+#define AddonData_H
+
+#include <napi.h>
+
+/*
+ * State of the addon in one environment (the main thread or a worker
+ * thread), stored as its instance data.
+ */
+struct AddonData {
+  Napi::FunctionReference constructor;
+
+  /*
+   * Brings work done on the addon's own thread pool back to this environment.
+   * Created on first use, and only keeps the event loop alive while there is
+   * pending work.
+   */
+  Napi::ThreadSafeFunction completions;
+  bool hasCompletions = false;
+  size_t pending = 0;
+
+  void WorkQueued(Napi::Env env) {
+    if (!hasCompletions) {
+      completions = Napi::ThreadSafeFunction::New(
+        env,
+        Napi::Function::New(env, Noop),
+        "hunspell",
+        0,
+        1
+      );
+      completions.Unref(env);
+      hasCompletions = true;
+    }
+
+    if (pending++ == 0) {
+      completions.Ref(env);
+    }
+  }
+
+  void WorkDone(Napi::Env env) {
+    if (--pending == 0) {
+      completions.Unref(env);
+    }
+  }
+
+private:
+  static Napi::Value Noop(const Napi::CallbackInfo& info) {
+    return info.Env().Undefined();
+  }
+};
+
+#endif
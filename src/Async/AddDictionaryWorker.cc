@@ -1,20 +1,29 @@
 #include <napi.h>
 #include <hunspell.hxx>
+#include <memory>
 #include "Worker.cc"
+#include "../MemoryFile.h"
 
 class AddDictionaryWorker : public Worker {
     public:
         AddDictionaryWorker(
             HunspellContext* context,
             Napi::Promise::Deferred d,
-            std::string dictionary)
-        : Worker(context, d), dictionary(dictionary) {}
+            FileArgument file)
+        : Worker(context, d), file(std::move(file)) {
+            operation = Stats::ADD;
+            isWrite = true;
+            lane = ThreadPool::SLOW;
+        }
 
     void Execute() {
         // Worker thread; don't use N-API here
-        context->lockWrite();
-        context->instance->add_dic(dictionary.c_str());
-        context->unlockWrite();
+        std::unique_ptr<MemoryFile> memory;
+        std::string dictionary = file.Open(memory, false);
+
+        context->write(operation, [&](Hunspell* instance) {
+            HunspellContext::AddDictionary(instance, dictionary);
+        });
     }
 
     void Resolve(Napi::Promise::Deferred const &deferred) {
@@ -24,5 +33,6 @@ class AddDictionaryWorker : public Worker {
     }
 
     private:
-        std::string dictionary;
+        // A path, or a buffer that is read in place
+        FileArgument file;
 };
\ No newline at end of file
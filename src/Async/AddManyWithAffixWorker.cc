@@ -0,0 +1,34 @@
+#include <napi.h>
+#include <hunspell.hxx>
+#include <utility>
+#include "Worker.cc"
+
+class AddManyWithAffixWorker : public Worker {
+    public:
+        AddManyWithAffixWorker(
+            HunspellContext* context,
+            Napi::Promise::Deferred d,
+            std::vector<std::pair<std::string, std::string>> pairs)
+        : Worker(context, d), pairs(std::move(pairs)) {
+            operation = Stats::ADD;
+            isWrite = true;
+        }
+
+    void Execute() {
+        // Worker thread; don't use N-API here
+        context->write(operation, [&](Hunspell* instance) {
+            for (const auto& pair : pairs) {
+                instance->add_with_affix(pair.first, pair.second);
+            }
+        });
+    }
+
+    void Resolve(Napi::Promise::Deferred const &deferred) {
+        Napi::Env env = deferred.Env();
+
+        deferred.Resolve(env.Undefined());
+    }
+
+    private:
+        std::vector<std::pair<std::string, std::string>> pairs;
+};
\ No newline at end of file
@@ -0,0 +1,33 @@
+#include <napi.h>
+#include <hunspell.hxx>
+#include "Worker.cc"
+
+class AddManyWorker : public Worker {
+    public:
+        AddManyWorker(
+            HunspellContext* context,
+            Napi::Promise::Deferred d,
+            std::vector<std::string> words)
+        : Worker(context, d), words(std::move(words)) {
+            operation = Stats::ADD;
+            isWrite = true;
+        }
+
+    void Execute() {
+        // Worker thread; don't use N-API here
+        context->write(operation, [&](Hunspell* instance) {
+            for (const std::string& word : words) {
+                instance->add(word);
+            }
+        });
+    }
+
+    void Resolve(Napi::Promise::Deferred const &deferred) {
+        Napi::Env env = deferred.Env();
+
+        deferred.Resolve(env.Undefined());
+    }
+
+    private:
+        std::vector<std::string> words;
+};
\ No newline at end of file
@@ -9,13 +9,16 @@ class AddWithAffixWorker : public Worker {
             Napi::Promise::Deferred d,
             std::string word,
             std::string example)
-        : Worker(context, d), word(word), example(example) {}
+        : Worker(context, d), word(std::move(word)), example(std::move(example)) {
+            operation = Stats::ADD;
+            isWrite = true;
+        }
 
     void Execute() {
         // Worker thread; don't use N-API here
-        context->lockWrite();
-        context->instance->add_with_affix(word.c_str(), example.c_str());
-        context->unlockWrite();
+        context->write(operation, [&](Hunspell* instance) {
+            instance->add_with_affix(word.c_str(), example.c_str());
+        });
     }
 
     void Resolve(Napi::Promise::Deferred const &deferred) {
@@ -8,13 +8,16 @@ class AddWorker : public Worker {
             HunspellContext* context,
             Napi::Promise::Deferred d,
             std::string word)
-        : Worker(context, d), word(word) {}
+        : Worker(context, d), word(std::move(word)) {
+            operation = Stats::ADD;
+            isWrite = true;
+        }
 
     void Execute() {
         // Worker thread; don't use N-API here
-        context->lockWrite();
-        context->instance->add(word.c_str());
-        context->unlockWrite();
+        context->write(operation, [&](Hunspell* instance) {
+            instance->add(word.c_str());
+        });
     }
 
     void Resolve(Napi::Promise::Deferred const &deferred) {
@@ -1,6 +1,7 @@
 #include <napi.h>
 #include <hunspell.hxx>
 #include "Worker.cc"
+#include "../Packed.h"
 
 class AnalyzeWorker : public Worker {
     public:
@@ -8,30 +9,24 @@ class AnalyzeWorker : public Worker {
             HunspellContext* context,
             Napi::Promise::Deferred d,
             std::string word)
-        : Worker(context, d), word(word) {}
+        : Worker(context, d), word(std::move(word)) {
+            operation = Stats::ANALYZE;
+        }
 
     void Execute() {
         // Worker thread; don't use N-API here
-        context->lockRead();
-        length = this->context->instance->analyze(&analysis, word.c_str());
-        context->unlockRead();
+        Hunspell* instance = context->acquire(operation);
+        analysis = context->analyze(instance, word);
+        context->release(instance);
     }
 
     void Resolve(Napi::Promise::Deferred const &deferred) {
         Napi::Env env = deferred.Env();
         
-        Napi::Array array = Napi::Array::New(env, length);
-        for (int i = 0; i < length; i++) {
-            array.Set(i, Napi::String::New(env, analysis[i]));
-        }
-
-        context->instance->free_list(&analysis, length);
-
-        deferred.Resolve(array);
+        deferred.Resolve(PackStrings(env, analysis));
     }
 
     private:
-        int length = 0;
         std::string word;
-        char** analysis = NULL;
+        std::vector<std::string> analysis;
 };
\ No newline at end of file
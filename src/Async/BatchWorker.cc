@@ -0,0 +1,97 @@
+#include <napi.h>
+#include <hunspell.hxx>
+#include <memory>
+#include "Worker.cc"
+#include "../Batch.h"
+
+/*
+ * Looks up words of a batch shared with other BatchWorkers, one of which is
+ * the primary: it waits for the others to finish their words and resolves the
+ * promise with all results. The others resolve a promise that nobody sees.
+ */
+class BatchWorker : public Worker {
+    public:
+        BatchWorker(
+            HunspellContext* context,
+            Napi::Promise::Deferred d,
+            Stats::Operation operation,
+            std::shared_ptr<Batch> batch,
+            SuggestLimits limits,
+            bool primary)
+        : Worker(context, d), batch(std::move(batch)), limits(limits), primary(primary) {
+            this->operation = operation;
+            this->limits.cancelled = &this->batch->cancelled;
+
+            if (operation == Stats::SUGGEST) {
+                lane = ThreadPool::SLOW;
+            }
+        }
+
+    void Execute() {
+        // Worker thread; don't use N-API here
+        Run(context, *batch, operation, limits);
+
+        if (primary) {
+            batch->Wait();
+        }
+    }
+
+    void Resolve(Napi::Promise::Deferred const &deferred) {
+        Napi::Env env = deferred.Env();
+
+        if (!primary) {
+            deferred.Resolve(env.Undefined());
+            return;
+        }
+
+        deferred.Resolve(batch->ToObject(env));
+    }
+
+    /*
+     * Look up words until there are none left. Suggestions are slow, so an
+     * instance is acquired per word, letting writes through in between. For
+     * other operations, per thread, but each word still counts as a call.
+     */
+    static void Run(
+        HunspellContext* context,
+        Batch& batch,
+        Stats::Operation operation,
+        const SuggestLimits& limits) {
+        if (operation == Stats::SUGGEST) {
+            batch.Work([&](size_t i) {
+                bool timedOut = false;
+                Hunspell* instance = context->acquire(operation);
+                batch.correct[i] = context->suggest(instance, batch.words[i], batch.results[i], limits, &timedOut);
+                batch.timedOut[i] = timedOut;
+                context->release(instance);
+            });
+
+            return;
+        }
+
+        Hunspell* instance = context->acquire(operation, false);
+        Stats::Counters& counters = context->stats.Of(operation);
+
+        batch.Work([&](size_t i) {
+            counters.calls.fetch_add(1, std::memory_order_relaxed);
+
+            if (operation == Stats::STEM) {
+                batch.results[i] = context->stem(instance, batch.words[i]);
+            } else {
+                batch.results[i] = context->analyze(instance, batch.words[i]);
+            }
+        });
+
+        context->release(instance);
+    }
+
+    protected:
+        void Aborted() {
+            batch->cancelled = true;
+        }
+
+    private:
+        std::shared_ptr<Batch> batch;
+        SuggestLimits limits;
+        bool primary;
+};
\ No newline at end of file
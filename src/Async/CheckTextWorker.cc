@@ -0,0 +1,69 @@
+#include <napi.h>
+#include <hunspell.hxx>
+#include <cstring>
+#include "Worker.cc"
+#include "../Tokenizer.h"
+
+class CheckTextWorker : public Worker {
+    public:
+        CheckTextWorker(
+            HunspellContext* context,
+            Napi::Promise::Deferred d,
+            std::string text,
+            Tokenizer tokenizer)
+        : Worker(context, d), text(std::move(text)), tokenizer(std::move(tokenizer)) {
+            lane = ThreadPool::SLOW;
+        }
+
+    // Append the (offset, length) of every misspelled word in text to ranges,
+    // stopping early once cancelled is set. The instance must have been
+    // acquired from the context.
+    static void Check(
+        HunspellContext* context,
+        Hunspell* instance,
+        const Tokenizer& tokenizer,
+        const char* text,
+        size_t length,
+        std::vector<uint32_t>& ranges,
+        const std::atomic<bool>* cancelled = NULL) {
+        std::string word;
+
+        tokenizer.Tokenize(text, length, [&](size_t offset, size_t size) {
+            if (cancelled && *cancelled) {
+                return false;
+            }
+
+            word.assign(text + offset, size);
+
+            if (!context->spell(instance, word)) {
+                ranges.push_back((uint32_t) offset);
+                ranges.push_back((uint32_t) size);
+            }
+
+            return true;
+        });
+    }
+
+    void Execute() {
+        // Worker thread; don't use N-API here
+        Hunspell* instance = context->acquire(operation);
+        Check(context, instance, tokenizer, text.data(), text.size(), ranges, &cancelled);
+        context->release(instance);
+    }
+
+    void Resolve(Napi::Promise::Deferred const &deferred) {
+        Napi::Env env = deferred.Env();
+
+        Napi::Uint32Array array = Napi::Uint32Array::New(env, ranges.size());
+        if (!ranges.empty()) {
+            memcpy(array.Data(), ranges.data(), ranges.size() * sizeof(uint32_t));
+        }
+
+        deferred.Resolve(array);
+    }
+
+    private:
+        std::string text;
+        Tokenizer tokenizer;
+        std::vector<uint32_t> ranges;
+};
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include <napi.h>
+#include <memory>
+#include <uv.h>
+#include "Worker.cc"
+#include "../MemoryFile.h"
+
+class CompileWorker : public Worker {
+    public:
+        CompileWorker(
+            Napi::Promise::Deferred d,
+            FileArgument affix,
+            FileArgument dictionary,
+            std::string output)
+        : Worker(NULL, d), affix(std::move(affix)), dictionary(std::move(dictionary)), output(std::move(output)) {
+            lane = ThreadPool::SLOW;
+        }
+
+    void Execute() {
+        // Worker thread; don't use N-API here
+        std::unique_ptr<MemoryFile> affixMemory;
+        std::unique_ptr<MemoryFile> dictionaryMemory;
+        std::string compiled = HunspellContext::Compile(
+            affix.Open(affixMemory, false),
+            dictionary.Open(dictionaryMemory, false)
+        );
+
+        if (!Write(compiled)) {
+            SetError("Could not write " + output);
+        }
+    }
+
+    void Resolve(Napi::Promise::Deferred const &deferred) {
+        Napi::Env env = deferred.Env();
+
+        deferred.Resolve(env.Undefined());
+    }
+
+    private:
+        // Paths, or buffers that are read in place
+        FileArgument affix;
+        FileArgument dictionary;
+        std::string output;
+
+        bool Write(const std::string& data) {
+            uv_fs_t req;
+            uv_file file = uv_fs_open(NULL, &req, output.c_str(), UV_FS_O_WRONLY | UV_FS_O_CREAT | UV_FS_O_TRUNC, 0644, NULL);
+            uv_fs_req_cleanup(&req);
+
+            if (file < 0) {
+                return false;
+            }
+
+            size_t written = 0;
+
+            while (written < data.size()) {
+                uv_buf_t buffer = uv_buf_init((char*) data.data() + written, (unsigned int) (data.size() - written));
+                int result = uv_fs_write(NULL, &req, file, &buffer, 1, -1, NULL);
+                uv_fs_req_cleanup(&req);
+
+                if (result <= 0) {
+                    break;
+                }
+
+                written += result;
+            }
+
+            int closed = uv_fs_close(NULL, &req, file, NULL);
+            uv_fs_req_cleanup(&req);
+
+            return written == data.size() && closed == 0;
+        }
+};
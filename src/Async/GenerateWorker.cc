@@ -1,6 +1,7 @@
 #include <napi.h>
 #include <hunspell.hxx>
 #include "Worker.cc"
+#include "../Packed.h"
 
 class GenerateWorker : public Worker {
     public:
@@ -9,35 +10,25 @@ class GenerateWorker : public Worker {
             Napi::Promise::Deferred d,
             std::string word,
             std::string example)
-        : Worker(context, d), word(word), example(example) {}
+        : Worker(context, d), word(std::move(word)), example(std::move(example)) {
+            operation = Stats::GENERATE;
+        }
 
     void Execute() {
         // Worker thread; don't use N-API here
-        context->lockRead();
-        length = context->instance->generate(
-            &generates,
-            word.c_str(),
-            example.c_str()
-        );
-        context->unlockRead();
+        Hunspell* instance = context->acquire(operation);
+        generates = instance->generate(word, example);
+        context->release(instance);
     }
 
     void Resolve(Napi::Promise::Deferred const &deferred) {
         Napi::Env env = deferred.Env();
         
-        Napi::Array array = Napi::Array::New(env, length);
-        for (int i = 0; i < length; i++) {
-            array.Set(i, Napi::String::New(env, generates[i]));
-        }
-        
-        context->instance->free_list(&generates, length);
-
-        deferred.Resolve(array);
+        deferred.Resolve(PackStrings(env, generates));
     }
 
     private:
-        int length = 0;
-        char** generates = NULL;
+        std::vector<std::string> generates;
         std::string word;
         std::string example;
 };
\ No newline at end of file
@@ -0,0 +1,51 @@
+#include <napi.h>
+#include <hunspell.hxx>
+#include "Worker.cc"
+#include "../LoadOptions.h"
+
+class LoadWorker : public Worker {
+    public:
+        LoadWorker(
+            Napi::Promise::Deferred d,
+            uv_loop_t* loop,
+            LoadOptions options)
+        : Worker(NULL, d), loop(loop), options(std::move(options)) {
+            lane = ThreadPool::SLOW;
+        }
+
+    ~LoadWorker() {
+        if (loaded) {
+            loaded->Release();
+        }
+    }
+
+    void Execute() {
+        // Worker thread; don't use N-API here
+        loaded = options.Load(loop);
+    }
+
+    void Abandoned() override {
+        if (loaded) {
+            loaded->Release();
+            loaded = NULL;
+        }
+    }
+
+    void Resolve(Napi::Promise::Deferred const &deferred) {
+        Napi::Env env = deferred.Env();
+
+        // The new object takes over our reference
+        Napi::FunctionReference& constructor = env.GetInstanceData<AddonData>()->constructor;
+        Napi::Object object = constructor.New({
+            Napi::External<HunspellContext>::New(env, loaded)
+        });
+        loaded = NULL;
+
+        deferred.Resolve(object);
+    }
+
+    private:
+        uv_loop_t* loop;
+        LoadOptions options;
+        HunspellContext* loaded = NULL;
+};
\ No newline at end of file
@@ -8,13 +8,16 @@ class RemoveWorker : public Worker {
             HunspellContext* context,
             Napi::Promise::Deferred d,
             std::string word)
-        : Worker(context, d), word(word) {}
+        : Worker(context, d), word(std::move(word)) {
+            operation = Stats::REMOVE;
+            isWrite = true;
+        }
 
     void Execute() {
         // Worker thread; don't use N-API here
-        context->lockRead();
-        context->instance->remove(word.c_str());
-        context->unlockRead();
+        context->write(operation, [&](Hunspell* instance) {
+            instance->remove(word.c_str());
+        });
     }
 
     void Resolve(Napi::Promise::Deferred const &deferred) {
@@ -0,0 +1,40 @@
+#include <napi.h>
+#include <hunspell.hxx>
+#include <cstring>
+#include "Worker.cc"
+
+class SpellBatchWorker : public Worker {
+    public:
+        SpellBatchWorker(
+            HunspellContext* context,
+            Napi::Promise::Deferred d,
+            std::vector<std::string> words)
+        : Worker(context, d), words(std::move(words)) {}
+
+    void Execute() {
+        // Worker thread; don't use N-API here
+        results.resize(words.size());
+
+        Hunspell* instance = context->acquire(operation);
+        for (size_t i = 0; i < words.size() && !cancelled; i++) {
+            if (i + 1 < words.size()) context->prefetch(words[i + 1]);
+            results[i] = context->spell(instance, words[i]) ? 1 : 0;
+        }
+        context->release(instance);
+    }
+
+    void Resolve(Napi::Promise::Deferred const &deferred) {
+        Napi::Env env = deferred.Env();
+
+        Napi::Uint8Array array = Napi::Uint8Array::New(env, results.size());
+        if (!results.empty()) {
+            memcpy(array.Data(), results.data(), results.size());
+        }
+
+        deferred.Resolve(array);
+    }
+
+    private:
+        std::vector<std::string> words;
+        std::vector<uint8_t> results;
+};
\ No newline at end of file
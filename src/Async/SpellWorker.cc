@@ -8,13 +8,13 @@ class SpellWorker : public Worker {
             HunspellContext* context,
             Napi::Promise::Deferred d,
             std::string word)
-        : Worker(context, d), word(word) {}
+        : Worker(context, d), word(std::move(word)) {}
 
     void Execute() {
         // Worker thread; don't use N-API here
-        context->lockRead();
-        correct = context->instance->spell(word.c_str());
-        context->unlockRead();
+        Hunspell* instance = context->acquire(operation);
+        correct = context->spell(instance, word);
+        context->release(instance);
     }
 
     void Resolve(Napi::Promise::Deferred const &deferred) {
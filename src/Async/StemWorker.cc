@@ -1,6 +1,7 @@
 #include <napi.h>
 #include <hunspell.hxx>
 #include "Worker.cc"
+#include "../Packed.h"
 
 class StemWorker : public Worker {
     public:
@@ -8,30 +9,24 @@ class StemWorker : public Worker {
             HunspellContext* context,
             Napi::Promise::Deferred d,
             std::string word)
-        : Worker(context, d), word(word) {}
+        : Worker(context, d), word(std::move(word)) {
+            operation = Stats::STEM;
+        }
 
     void Execute() {
         // Worker thread; don't use N-API here
-        context->lockRead();
-        length = this->context->instance->stem(&stems, word.c_str());
-        context->unlockRead();
+        Hunspell* instance = context->acquire(operation);
+        stems = context->stem(instance, word);
+        context->release(instance);
     }
 
     void Resolve(Napi::Promise::Deferred const &deferred) {
         Napi::Env env = deferred.Env();
         
-        Napi::Array array = Napi::Array::New(env, length);
-        for (int i = 0; i < length; i++) {
-            array.Set(i, Napi::String::New(env, stems[i]));
-        }
-        
-        context->instance->free_list(&stems, length);
-
-        deferred.Resolve(array);
+        deferred.Resolve(PackStrings(env, stems));
     }
 
     private:
-        int length = 0;
         std::string word;
-        char** stems = NULL;
+        std::vector<std::string> stems;
 };
\ No newline at end of file
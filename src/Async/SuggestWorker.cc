@@ -1,45 +1,49 @@
 #include <napi.h>
 #include <hunspell.hxx>
 #include "Worker.cc"
+#include "../Packed.h"
 
 class SuggestWorker : public Worker {
     public:
         SuggestWorker(
             HunspellContext* context,
             Napi::Promise::Deferred d,
-            std::string word)
-        : Worker(context, d), word(word) {}
+            std::string word,
+            SuggestLimits limits)
+        : Worker(context, d), word(std::move(word)), limits(limits) {
+            operation = Stats::SUGGEST;
+            this->limits.cancelled = &cancelled;
+            lane = ThreadPool::SLOW;
+        }
 
     void Execute() {
         // Worker thread; don't use N-API here
-        context->lockRead();
-        bool correct = context->instance->spell(word.c_str());
-        if (!correct) {
-            length = this->context->instance->suggest(&suggestions, word.c_str());
-        }
-        context->unlockRead();
+        Hunspell* instance = context->acquire(operation);
+        correct = context->suggest(instance, word, suggestions, limits, &timedOut);
+        context->release(instance);
     }
 
     void Resolve(Napi::Promise::Deferred const &deferred) {
         Napi::Env env = deferred.Env();
 
-        if (length == -1) {
+        if (correct) {
             deferred.Resolve(env.Null());
             return;
         }
 
-        Napi::Array array = Napi::Array::New(env, length);
-        for (int i = 0; i < length; i++) {
-            array.Set(i, Napi::String::New(env, suggestions[i]));
-        }
+        Napi::Object packed = PackStrings(env, suggestions);
 
-        context->instance->free_list(&suggestions, length);
+        if (timedOut) {
+            packed.Set("timedOut", true);
+        }
 
-        deferred.Resolve(array);
+        deferred.Resolve(packed);
     }
 
     private:
-        int length = -1;
+        bool correct = false;
+        bool timedOut = false;
         std::string word;
-        char** suggestions = NULL;
+        SuggestLimits limits;
+        std::vector<std::string> suggestions;
 };
\ No newline at end of file
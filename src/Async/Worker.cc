@@ -4,25 +4,150 @@
 // Thanks @jaubourg, @Superlokkus, and @greg9504.
 // https://github.com/nodejs/node-addon-api/issues/231
 #include <napi.h>
+#include <atomic>
+#include <uv.h>
+#include "../AddonData.h"
 #include "../HunspellContext.h"
+#include "../ThreadPool.h"
 
-class Worker : public Napi::AsyncWorker {
+class Worker : public Napi::AsyncWorker, public ThreadPool::Task {
 public:
-    Worker(HunspellContext* context, Napi::Promise::Deferred const &d, const char* resource_name) : AsyncWorker(get_fake_callback(d.Env()).Value(), resource_name), deferred(d), context(context) {}
-    Worker(HunspellContext* context, Napi::Promise::Deferred const &d) : AsyncWorker(get_fake_callback(d.Env()).Value()), deferred(d), context(context) {}
+    Worker(HunspellContext* context, Napi::Promise::Deferred const &d, const char* resource_name) : AsyncWorker(get_fake_callback(d.Env()).Value(), resource_name), deferred(d), context(context) {
+        if (context) context->Ref();
+    }
+
+    Worker(HunspellContext* context, Napi::Promise::Deferred const &d) : AsyncWorker(get_fake_callback(d.Env()).Value()), deferred(d), context(context) {
+        if (context) context->Ref();
+    }
+
+    // Keeps the context alive if the Hunspell object is garbage collected
+    // while this worker is running
+    ~Worker() {
+        ReleaseContext();
+    }
 
     virtual void Resolve(Napi::Promise::Deferred const &deferred) = 0;
 
+    /*
+     * Queue, unless the AbortSignal (or undefined) was already aborted. If it
+     * aborts later, the worker is dropped if it hasn't started yet, and is
+     * asked to stop otherwise. The promise is then rejected with the signal's
+     * reason, except by writes that already started, since those can't be
+     * undone.
+     */
+    void Queue(Napi::Value signal) {
+        if (signal.IsObject()) {
+            Napi::Object object = signal.As<Napi::Object>();
+
+            if (object.Get("aborted").ToBoolean()) {
+                deferred.Reject(object.Get("reason"));
+                Destroy();
+                return;
+            }
+
+            this->signal = Napi::Persistent(object);
+            listener = Napi::Persistent(Napi::Function::New(Env(), [this](const Napi::CallbackInfo&) {
+                Abort();
+            }));
+
+            object.Get("addEventListener").As<Napi::Function>().Call(object, {
+                Napi::String::New(Env(), "abort"),
+                listener.Value()
+            });
+        }
+
+        if (context) {
+            context->stats.Of(operation).inFlight++;
+            queued = true;
+            queuedAt = uv_hrtime();
+        }
+
+        // Use the addon's own threads if Hunspell.setThreadPoolSize() was
+        // called, otherwise the libuv threadpool
+        if (ThreadPool::Shared().Size() > 0) {
+            AddonData* data = Env().GetInstanceData<AddonData>();
+            data->WorkQueued(Env());
+            completions = data->completions;
+
+            if (ThreadPool::Shared().Submit(this, lane)) {
+                pooled = true;
+                return;
+            }
+
+            data->WorkDone(Env());
+        }
+
+        AsyncWorker::Queue();
+    }
+
+    // Worker thread; don't use N-API here
+    void OnExecute(Napi::Env env) override {
+        uint64_t start = uv_hrtime();
+
+        if (context) context->stats.Of(operation).queueWait.Record(start - queuedAt);
+        AsyncWorker::OnExecute(env);
+        if (context) context->stats.Of(operation).execute.Record(uv_hrtime() - start);
+    }
+
+    // Pool thread; don't use N-API here except to hand the worker back
+    void Run() override {
+        OnExecute(Env());
+
+        napi_status status = completions.NonBlockingCall([this](Napi::Env env, Napi::Function callback) {
+            env.GetInstanceData<AddonData>()->WorkDone(env);
+            OnWorkComplete(env, napi_ok);
+        });
+
+        // The environment is shutting down, such as a worker thread exiting,
+        // so this worker will never be completed. Release the dictionary
+        // and what the worker holds here. The worker itself is left behind:
+        // its destructor would call N-API, which can't be done from this
+        // thread.
+        if (status != napi_ok) {
+            ReleaseContext();
+            Abandoned();
+        }
+    }
+
     void OnOK() override {
-        Resolve(deferred);
+        StopListening();
+
+        if (cancelled && !isWrite) {
+            deferred.Reject(signal.Value().Get("reason"));
+        } else {
+            Resolve(deferred);
+        }
     }
 
     void OnError(Napi::Error const &error) override {
+        StopListening();
         deferred.Reject(error.Value());
     }
 
 protected:
     HunspellContext* context;
+
+    // Set when the signal aborts. Long-running reads should check it.
+    std::atomic<bool> cancelled{false};
+
+    // Called when the signal aborts, on the main thread, before the worker is
+    // possibly destroyed
+    virtual void Aborted() {}
+
+    // Called on the pool thread instead of completing the worker, when the
+    // environment is shutting down. Must release the native resources that
+    // the destructor would, without N-API.
+    virtual void Abandoned() {}
+
+    // Set by workers that modify the dictionary
+    bool isWrite = false;
+
+    // Set by workers that can take long, so they don't hold up the others on
+    // the addon's thread pool
+    ThreadPool::Lane lane = ThreadPool::FAST;
+
+    // What the worker counts as in the context's stats
+    Stats::Operation operation = Stats::SPELL;
     
 private:
     static Napi::Value noop(Napi::CallbackInfo const &info) {
@@ -38,6 +163,60 @@ private:
     }
 
     Napi::Promise::Deferred deferred;
+    Napi::ObjectReference signal;
+    Napi::FunctionReference listener;
+    Napi::ThreadSafeFunction completions;
+    bool pooled = false;
+    bool queued = false;
+    uint64_t queuedAt = 0;
+
+    void Abort() {
+        cancelled = true;
+        Aborted();
+        StopListening();
+
+        if (pooled) {
+            // Only succeeds if the work hasn't started
+            if (ThreadPool::Shared().Cancel(this)) {
+                Env().GetInstanceData<AddonData>()->WorkDone(Env());
+                deferred.Reject(signal.Value().Get("reason"));
+                Destroy();
+            }
+
+            return;
+        }
+
+        // Only succeeds if the work hasn't started. Then neither OnOK() nor
+        // OnError() is called, but the worker is still destroyed.
+        if (napi_cancel_async_work(Env(), *this) == napi_ok) {
+            deferred.Reject(signal.Value().Get("reason"));
+        }
+    }
+
+    void ReleaseContext() {
+        if (!context) {
+            return;
+        }
+
+        if (queued) context->stats.Of(operation).inFlight--;
+        context->Unref();
+        context = NULL;
+    }
+
+    void StopListening() {
+        if (listener.IsEmpty()) {
+            return;
+        }
+
+        Napi::Object object = signal.Value();
+
+        object.Get("removeEventListener").As<Napi::Function>().Call(object, {
+            Napi::String::New(Env(), "abort"),
+            listener.Value()
+        });
+
+        listener.Reset();
+    }
 };
 
 #endif
\ No newline at end of file
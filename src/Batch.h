@@ -0,0 +1,193 @@
+#ifndef Batch_H
+#define Batch_H
+
+#include <napi.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/*
+ * Words to look up in bulk, deduplicated, and their results. Any number of
+ * threads can take words from the batch at the same time, so that a batch is
+ * done when its slowest word is.
+ *
+ * Results are returned to JavaScript packed: the strings of all words
+ * concatenated into one buffer, with offsets to find them by, which JS
+ * decodes on demand. See BatchResults in index.js.
+ */
+class Batch {
+public:
+  // Unique words, in order of first occurrence
+  std::vector<std::string> words;
+
+  // For each given word, the index of its unique word
+  std::vector<uint32_t> indices;
+
+  // For each unique word, its results, and whether it's spelled correctly
+  // and whether looking for its results timed out, if hasCorrect is set
+  std::vector<std::vector<std::string>> results;
+  std::vector<uint8_t> correct;
+  std::vector<uint8_t> timedOut;
+  bool hasCorrect = false;
+
+  // Set to stop taking words
+  std::atomic<bool> cancelled{false};
+
+  Batch(const std::vector<std::string>& given) {
+    Dedupe(given.size(), [&](size_t i) {
+      return std::string_view(given[i]);
+    });
+  }
+
+  // Words packed like results, as data and count + 1 offsets. The offsets
+  // must have been validated.
+  Batch(const char* data, const uint32_t* offsets, size_t count) {
+    Dedupe(count, [&](size_t i) {
+      return std::string_view(data + offsets[i], offsets[i + 1] - offsets[i]);
+    });
+  }
+
+  /*
+   * Call process(i) for words not taken by another thread, until there are
+   * none left or the batch is cancelled.
+   */
+  template<typename Process>
+  void Work(Process process) {
+    while (true) {
+      // Counted before taking a word, so that Wait() can't miss it
+      inProgress++;
+      size_t i = next++;
+
+      if (i >= words.size() || cancelled) {
+        Leave();
+        return;
+      }
+
+      process(i);
+      Leave();
+    }
+  }
+
+  // Wait for other threads to finish the words they took
+  void Wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    waiting = true;
+    finished.wait(lock, [&]() {
+      return inProgress == 0;
+    });
+    waiting = false;
+  }
+
+  /*
+   * Pack the results as { data, offsets, groups, indices, correct,
+   * timedOut }: the results of unique word i are the strings groups[i] to
+   * groups[i + 1], and string j is data from offsets[j] to offsets[j + 1].
+   */
+  Napi::Object ToObject(Napi::Env env) const {
+    size_t strings = 0;
+    size_t bytes = 0;
+
+    for (const std::vector<std::string>& group : results) {
+      strings += group.size();
+
+      for (const std::string& s : group) {
+        bytes += s.size();
+      }
+    }
+
+    Napi::Buffer<char> data = Napi::Buffer<char>::New(env, bytes);
+    Napi::Uint32Array offsets = Napi::Uint32Array::New(env, strings + 1);
+    Napi::Uint32Array groups = Napi::Uint32Array::New(env, results.size() + 1);
+    Napi::Uint32Array indexes = Napi::Uint32Array::New(env, indices.size());
+    size_t string = 0;
+    size_t offset = 0;
+
+    for (size_t i = 0; i < results.size(); i++) {
+      groups[i] = (uint32_t) string;
+
+      for (const std::string& s : results[i]) {
+        offsets[string++] = (uint32_t) offset;
+        memcpy(data.Data() + offset, s.data(), s.size());
+        offset += s.size();
+      }
+    }
+
+    offsets[string] = (uint32_t) offset;
+    groups[results.size()] = (uint32_t) string;
+
+    if (!indices.empty()) {
+      memcpy(indexes.Data(), indices.data(), indices.size() * sizeof(uint32_t));
+    }
+
+    Napi::Object object = Napi::Object::New(env);
+    object.Set("data", data);
+    object.Set("offsets", offsets);
+    object.Set("groups", groups);
+    object.Set("indices", indexes);
+
+    if (hasCorrect) {
+      Napi::Uint8Array flags = Napi::Uint8Array::New(env, correct.size());
+
+      if (!correct.empty()) {
+        memcpy(flags.Data(), correct.data(), correct.size());
+      }
+
+      object.Set("correct", flags);
+
+      Napi::Uint8Array timeouts = Napi::Uint8Array::New(env, timedOut.size());
+
+      if (!timedOut.empty()) {
+        memcpy(timeouts.Data(), timedOut.data(), timedOut.size());
+      }
+
+      object.Set("timedOut", timeouts);
+    }
+
+    return object;
+  }
+
+private:
+  std::atomic<size_t> next{0};
+  std::atomic<size_t> inProgress{0};
+  std::atomic<bool> waiting{false};
+  std::mutex mutex;
+  std::condition_variable finished;
+
+  // Only unique words are copied
+  template<typename Get>
+  void Dedupe(size_t count, Get get) {
+    std::unordered_map<std::string_view, uint32_t> seen;
+
+    indices.reserve(count);
+
+    for (size_t i = 0; i < count; i++) {
+      std::string_view word = get(i);
+      auto inserted = seen.emplace(word, (uint32_t) words.size());
+
+      if (inserted.second) {
+        words.emplace_back(word);
+      }
+
+      indices.push_back(inserted.first->second);
+    }
+
+    results.resize(words.size());
+    correct.resize(words.size());
+    timedOut.resize(words.size());
+  }
+
+  void Leave() {
+    if (--inProgress == 0 && waiting) {
+      std::lock_guard<std::mutex> guard(mutex);
+      finished.notify_all();
+    }
+  }
+};
+
+#endif
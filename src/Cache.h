@@ -0,0 +1,108 @@
+#ifndef Cache_H
+#define Cache_H
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*
+ * Bounded least-recently-used cache that can be used from multiple threads.
+ * Split into shards with a mutex each, so that threads rarely contend.
+ */
+template <typename V>
+class Cache {
+public:
+  Cache(size_t capacity)
+  : capacity(capacity),
+    shards(capacity >= 1024 ? 16 : 1) {
+    for (Shard& shard : shards) {
+      shard.capacity = (capacity + shards.size() - 1) / shards.size();
+    }
+  }
+
+  // Copy the cached value of key into value. Returns false if not cached.
+  bool get(const std::string& key, V& value) {
+    Shard& shard = shardOf(key);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    auto it = shard.index.find(key);
+
+    if (it == shard.index.end()) {
+      misses++;
+      return false;
+    }
+
+    shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+    value = it->second->second;
+    hits++;
+
+    return true;
+  }
+
+  void set(const std::string& key, const V& value) {
+    Shard& shard = shardOf(key);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    auto it = shard.index.find(key);
+
+    if (it != shard.index.end()) {
+      it->second->second = value;
+      shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+      return;
+    }
+
+    shard.entries.emplace_front(key, value);
+    shard.index[key] = shard.entries.begin();
+
+    if (shard.entries.size() > shard.capacity) {
+      shard.index.erase(shard.entries.back().first);
+      shard.entries.pop_back();
+    }
+  }
+
+  void clear() {
+    for (Shard& shard : shards) {
+      std::lock_guard<std::mutex> guard(shard.mutex);
+      shard.index.clear();
+      shard.entries.clear();
+    }
+  }
+
+  size_t size() {
+    size_t total = 0;
+
+    for (Shard& shard : shards) {
+      std::lock_guard<std::mutex> guard(shard.mutex);
+      total += shard.entries.size();
+    }
+
+    return total;
+  }
+
+  const size_t capacity;
+  std::atomic<uint64_t> hits{0};
+  std::atomic<uint64_t> misses{0};
+
+private:
+  typedef std::list<std::pair<std::string, V>> Entries;
+
+  struct Shard {
+    std::mutex mutex;
+    size_t capacity = 0;
+    Entries entries;
+    std::unordered_map<std::string, typename Entries::iterator> index;
+  };
+
+  std::vector<Shard> shards;
+
+  Shard& shardOf(const std::string& key) {
+    return shards[std::hash<std::string>()(key) % shards.size()];
+  }
+};
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef DictionaryFile_H
+#define DictionaryFile_H
+
+#include <filemgr.hxx>
+#include <string>
+#include <vector>
+
+/*
+ * Reads the words of a .dic file without their flags and morphological
+ * fields, for the structures built next to Hunspell's own word list. Uses
+ * Hunspell's FileMgr, so that files in memory can be read too.
+ */
+class DictionaryFile {
+public:
+  static std::vector<std::string> Words(const std::string& dictionaryFile) {
+    FileMgr file(dictionaryFile.c_str());
+    std::vector<std::string> words;
+    std::string line;
+
+    // The first line is the number of words
+    file.getline(line);
+
+    while (file.getline(line)) {
+      std::string word = Word(line);
+
+      if (!word.empty()) {
+        words.push_back(word);
+      }
+    }
+
+    return words;
+  }
+
+private:
+  // The word of a line, which ends at an unescaped slash (before its flags)
+  // or at whitespace (before its morphological fields)
+  static std::string Word(const std::string& line) {
+    std::string word;
+
+    for (size_t i = 0; i < line.size(); i++) {
+      char c = line[i];
+
+      if (c == '\\' && i + 1 < line.size() && line[i + 1] == '/') {
+        word += '/';
+        i++;
+      } else if (c == '/' || c == '\t' || c == ' ' || c == '\r') {
+        break;
+      } else {
+        word += c;
+      }
+    }
+
+    return word;
+  }
+};
+
+#endif
@@ -1,19 +1,474 @@
 #include "HunspellBinding.h"
 #include <napi.h>
 #include <hunspell.hxx>
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include "LoadOptions.h"
+#include "Packed.h"
+#include "Async/LoadWorker.cc"
+#include "Async/CompileWorker.cc"
 #include "Async/AddDictionaryWorker.cc"
 #include "Async/SpellWorker.cc"
+#include "Async/SpellBatchWorker.cc"
+#include "Async/CheckTextWorker.cc"
 #include "Async/SuggestWorker.cc"
+#include "Async/BatchWorker.cc"
 #include "Async/AnalyzeWorker.cc"
 #include "Async/StemWorker.cc"
 #include "Async/GenerateWorker.cc"
 #include "Async/AddWorker.cc"
 #include "Async/AddWithAffixWorker.cc"
 #include "Async/RemoveWorker.cc"
+#include "Async/AddManyWorker.cc"
+#include "Async/AddManyWithAffixWorker.cc"
+#include "Async/RemoveManyWorker.cc"
 
 const std::string INVALID_NUMBER_OF_ARGUMENTS = "Invalid number of arguments.";
 const std::string INVALID_FIRST_ARGUMENT = "First argument is invalid.";
 const std::string INVALID_SECOND_ARGUMENT = "Second argument is invalid.";
+const std::string INVALID_THIRD_ARGUMENT = "Third argument is invalid.";
+
+const uint32_t MAX_THREAD_POOL_SIZE = 1024;
+
+// Read a string that's likely short, like a word. Utf8Value() asks for the
+// length first and then copies; this copies into a stack buffer in one call.
+// A string that may not have fit is decoded again, straight into the result.
+static std::string ToWord(Napi::Value value) {
+  napi_env env = value.Env();
+  char buffer[256];
+  size_t length = 0;
+
+  napi_get_value_string_utf8(env, value, buffer, sizeof(buffer), &length);
+
+  // Truncation happens at a character boundary, so up to 3 bytes early
+  if (length + 4 >= sizeof(buffer)) {
+    napi_get_value_string_utf8(env, value, NULL, 0, &length);
+
+    std::string word(length, '\0');
+    napi_get_value_string_utf8(env, value, &word[0], length + 1, &length);
+
+    return word;
+  }
+
+  return std::string(buffer, length);
+}
+
+// Copy an array of strings into words. Returns false if value is not an
+// array or if any of its elements is not a string.
+static bool ToStringVector(Napi::Value value, std::vector<std::string>& words) {
+  if (!value.IsArray()) {
+    return false;
+  }
+
+  Napi::Array array = value.As<Napi::Array>();
+  uint32_t length = array.Length();
+
+  words.reserve(length);
+
+  for (uint32_t i = 0; i < length; i++) {
+    Napi::Value element = array.Get(i);
+
+    if (!element.IsString()) {
+      return false;
+    }
+
+    words.push_back(ToWord(element));
+  }
+
+  return true;
+}
+
+// Copy an array of [word, example] arrays into pairs. Returns false if value
+// is not such an array.
+static bool ToStringPairs(Napi::Value value, std::vector<std::pair<std::string, std::string>>& pairs) {
+  if (!value.IsArray()) {
+    return false;
+  }
+
+  Napi::Array array = value.As<Napi::Array>();
+  uint32_t length = array.Length();
+
+  pairs.reserve(length);
+
+  for (uint32_t i = 0; i < length; i++) {
+    Napi::Value element = array.Get(i);
+
+    if (!element.IsArray() || element.As<Napi::Array>().Length() != 2) {
+      return false;
+    }
+
+    Napi::Value word = element.As<Napi::Array>().Get((uint32_t) 0);
+    Napi::Value example = element.As<Napi::Array>().Get((uint32_t) 1);
+
+    if (!word.IsString() || !example.IsString()) {
+      return false;
+    }
+
+    pairs.emplace_back(ToWord(word), ToWord(example));
+  }
+
+  return true;
+}
+
+static bool IsUint8Array(Napi::Value value) {
+  return value.IsTypedArray() &&
+    value.As<Napi::TypedArray>().TypedArrayType() == napi_uint8_array;
+}
+
+static bool IsFile(Napi::Value value) {
+  return value.IsString() || IsUint8Array(value);
+}
+
+// Read the options of the constructor and load(). Returns false if they're
+// invalid.
+static bool ToOptions(Napi::Value value, LoadOptions& options) {
+  if (value.IsUndefined()) {
+    return true;
+  } else if (!value.IsObject()) {
+    return false;
+  }
+
+  Napi::Value concurrency = value.As<Napi::Object>().Get("concurrency");
+
+  if (!concurrency.IsUndefined()) {
+    if (!concurrency.IsNumber()) {
+      return false;
+    }
+
+    double number = concurrency.As<Napi::Number>().DoubleValue();
+
+    if (!(number >= 1 && number <= UINT32_MAX) || number != (uint32_t) number) {
+      return false;
+    }
+
+    options.concurrency = (uint32_t) number;
+  }
+
+  Napi::Value shared = value.As<Napi::Object>().Get("shared");
+
+  if (!shared.IsUndefined()) {
+    if (!shared.IsBoolean()) {
+      return false;
+    }
+
+    options.shared = shared.As<Napi::Boolean>().Value();
+  }
+
+  Napi::Value cacheSize = value.As<Napi::Object>().Get("cacheSize");
+
+  if (!cacheSize.IsUndefined()) {
+    if (!cacheSize.IsNumber()) {
+      return false;
+    }
+
+    double number = cacheSize.As<Napi::Number>().DoubleValue();
+
+    if (!(number >= 0 && number <= UINT32_MAX) || number != (uint32_t) number) {
+      return false;
+    }
+
+    options.cacheSize = (size_t) number;
+  }
+
+  Napi::Value lockFreeReads = value.As<Napi::Object>().Get("lockFreeReads");
+
+  if (!lockFreeReads.IsUndefined()) {
+    if (!lockFreeReads.IsBoolean()) {
+      return false;
+    }
+
+    options.lockFreeReads = lockFreeReads.As<Napi::Boolean>().Value();
+  }
+
+  Napi::Value suggestIndex = value.As<Napi::Object>().Get("suggestIndex");
+
+  if (!suggestIndex.IsUndefined()) {
+    if (!suggestIndex.IsBoolean()) {
+      return false;
+    }
+
+    options.suggestIndex = suggestIndex.As<Napi::Boolean>().Value();
+  }
+
+  Napi::Value wordStore = value.As<Napi::Object>().Get("wordStore");
+
+  if (!wordStore.IsUndefined()) {
+    if (!wordStore.IsBoolean()) {
+      return false;
+    }
+
+    options.wordStore = wordStore.As<Napi::Boolean>().Value();
+  }
+
+  return true;
+}
+
+// Convert a histogram of nanoseconds to an object in milliseconds, with
+// the non-empty buckets as [upper bound, count] pairs
+static Napi::Object ToHistogram(Napi::Env env, const Histogram& histogram) {
+  Napi::Object object = Napi::Object::New(env);
+  Napi::Array buckets = Napi::Array::New(env);
+
+  for (int i = 0; i < Histogram::BUCKETS; i++) {
+    uint64_t count = histogram.Bucket(i);
+
+    if (count > 0) {
+      Napi::Array bucket = Napi::Array::New(env, 2);
+      bucket.Set((uint32_t) 0, Napi::Number::New(env, Histogram::UpperBound(i) / 1e6));
+      bucket.Set((uint32_t) 1, Napi::Number::New(env, (double) count));
+      buckets.Set(buckets.Length(), bucket);
+    }
+  }
+
+  object.Set("count", Napi::Number::New(env, (double) histogram.Count()));
+  object.Set("sum", Napi::Number::New(env, histogram.Sum() / 1e6));
+  object.Set("max", Napi::Number::New(env, histogram.Max() / 1e6));
+  object.Set("p50", Napi::Number::New(env, histogram.Percentile(0.5) / 1e6));
+  object.Set("p90", Napi::Number::New(env, histogram.Percentile(0.9) / 1e6));
+  object.Set("p99", Napi::Number::New(env, histogram.Percentile(0.99) / 1e6));
+  object.Set("p999", Napi::Number::New(env, histogram.Percentile(0.999) / 1e6));
+  object.Set("buckets", buckets);
+
+  return object;
+}
+
+// Read the arguments of the constructor and load(). Returns an error if
+// they're invalid.
+static Napi::Error ToLoadOptions(const Napi::CallbackInfo& info, LoadOptions& options) {
+  Napi::Env env = info.Env();
+
+  Napi::Value aff;
+  Napi::Value dic;
+
+  if ((info.Length() == 1 || info.Length() == 2) && info[0].IsObject()) {
+    Napi::Object dictionary = info[0].As<Napi::Object>();
+
+    if (!dictionary.Has("aff") || !dictionary.Has("dic")) {
+      return Napi::TypeError::New(env, INVALID_FIRST_ARGUMENT);
+    }
+
+    aff = dictionary.Get("aff");
+    dic = dictionary.Get("dic");
+
+    if (!IsFile(aff) || !IsFile(dic)) {
+      return Napi::TypeError::New(env, INVALID_FIRST_ARGUMENT);
+    }
+
+    if (!ToOptions(info[1], options)) {
+      return Napi::TypeError::New(env, INVALID_SECOND_ARGUMENT);
+    }
+  } else if (info.Length() == 2) {
+    if (!info[0].IsString()) {
+      return Napi::TypeError::New(env, INVALID_FIRST_ARGUMENT);
+    }
+
+    if (!info[1].IsString()) {
+      return Napi::TypeError::New(env, INVALID_SECOND_ARGUMENT);
+    }
+
+    aff = info[0];
+    dic = info[1];
+  } else {
+    return Napi::TypeError::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+  }
+
+  options.affix = FileArgument(aff);
+  options.dictionary = FileArgument(dic);
+
+  return Napi::Error();
+}
+
+// Read the options of checkText() and combine its extra word characters with
+// those of the dictionary. Returns false if the options are invalid.
+static bool ToWordCharacters(Napi::Value options, HunspellContext* context, std::string& wordCharacters) {
+  wordCharacters = context->wordCharacters;
+
+  if (options.IsUndefined()) {
+    return true;
+  } else if (!options.IsObject()) {
+    return false;
+  }
+
+  Napi::Value extra = options.As<Napi::Object>().Get("wordCharacters");
+
+  if (extra.IsString()) {
+    wordCharacters += extra.As<Napi::String>().Utf8Value();
+  } else if (!extra.IsUndefined()) {
+    return false;
+  }
+
+  return true;
+}
+
+// Read the AbortSignal from the options of an asynchronous method, if there is
+// one. Returns false if the options are invalid.
+static bool ToSignal(Napi::Value options, Napi::Value& signal) {
+  if (options.IsUndefined()) {
+    return true;
+  } else if (!options.IsObject()) {
+    return false;
+  }
+
+  signal = options.As<Napi::Object>().Get("signal");
+
+  if (signal.IsUndefined()) {
+    return true;
+  }
+
+  return signal.IsObject() && signal.As<Napi::Object>().Get("addEventListener").IsFunction();
+}
+
+// Read the options of suggest(). Returns false if they're invalid, which
+// includes the indexed engine if the dictionary was loaded without an index.
+static bool ToSuggestLimits(Napi::Value options, SuggestLimits& limits, bool hasIndex) {
+  if (options.IsUndefined()) {
+    return true;
+  } else if (!options.IsObject()) {
+    return false;
+  }
+
+  Napi::Value maxSuggestions = options.As<Napi::Object>().Get("maxSuggestions");
+
+  if (!maxSuggestions.IsUndefined()) {
+    if (!maxSuggestions.IsNumber()) {
+      return false;
+    }
+
+    double number = maxSuggestions.As<Napi::Number>().DoubleValue();
+
+    if (!(number >= 1 && number <= UINT32_MAX) || number != (uint32_t) number) {
+      return false;
+    }
+
+    limits.maxSuggestions = (size_t) number;
+  }
+
+  Napi::Value timeoutMs = options.As<Napi::Object>().Get("timeoutMs");
+
+  if (!timeoutMs.IsUndefined()) {
+    if (!timeoutMs.IsNumber()) {
+      return false;
+    }
+
+    double number = timeoutMs.As<Napi::Number>().DoubleValue();
+
+    if (!(number >= 0 && number <= UINT32_MAX)) {
+      return false;
+    }
+
+    // Counted from now, so that time spent waiting for the threadpool counts.
+    // Never 0, which means there's no deadline.
+    limits.deadline = uv_hrtime() + (uint64_t) (number * 1e6) + 1;
+  }
+
+  Napi::Value engine = options.As<Napi::Object>().Get("engine");
+
+  if (!engine.IsUndefined()) {
+    if (!engine.IsString()) {
+      return false;
+    }
+
+    std::string name = engine.As<Napi::String>().Utf8Value();
+
+    if (name == "indexed" && hasIndex) {
+      limits.indexed = true;
+    } else if (name != "hunspell") {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Read the words of a batch method, given as an array of strings or packed as
+// { data: Uint8Array, offsets: Uint32Array }, where word i is data from
+// offsets[i] to offsets[i + 1]. Returns NULL if they're invalid.
+static std::shared_ptr<Batch> ToBatch(Napi::Value value) {
+  if (value.IsArray()) {
+    std::vector<std::string> words;
+
+    if (!ToStringVector(value, words)) {
+      return NULL;
+    }
+
+    return std::make_shared<Batch>(words);
+  } else if (!value.IsObject()) {
+    return NULL;
+  }
+
+  Napi::Value data = value.As<Napi::Object>().Get("data");
+  Napi::Value offsets = value.As<Napi::Object>().Get("offsets");
+
+  if (!IsUint8Array(data) ||
+      !offsets.IsTypedArray() ||
+      offsets.As<Napi::TypedArray>().TypedArrayType() != napi_uint32_array) {
+    return NULL;
+  }
+
+  Napi::Uint8Array bytes = data.As<Napi::Uint8Array>();
+  Napi::Uint32Array bounds = offsets.As<Napi::Uint32Array>();
+  size_t length = bounds.ElementLength();
+
+  if (length == 0) {
+    return NULL;
+  }
+
+  for (size_t i = 0; i < length; i++) {
+    if (bounds[i] > bytes.ByteLength() || (i > 0 && bounds[i] < bounds[i - 1])) {
+      return NULL;
+    }
+  }
+
+  return std::make_shared<Batch>((const char*) bytes.Data(), bounds.Data(), length - 1);
+}
+
+// Read the number of threads to spread a batch over from the options of a
+// batch method. Returns false if the options are invalid.
+static bool ToParallelism(Napi::Value options, size_t& parallelism) {
+  if (options.IsUndefined()) {
+    return true;
+  } else if (!options.IsObject()) {
+    return false;
+  }
+
+  Napi::Value value = options.As<Napi::Object>().Get("parallelism");
+
+  if (!value.IsUndefined()) {
+    if (!value.IsNumber()) {
+      return false;
+    }
+
+    double number = value.As<Napi::Number>().DoubleValue();
+
+    if (!(number >= 1 && number <= MAX_THREAD_POOL_SIZE) || number != (uint32_t) number) {
+      return false;
+    }
+
+    parallelism = (size_t) number;
+  }
+
+  return true;
+}
+
+// Number of threads that run asynchronous work: the addon's own if
+// Hunspell.setThreadPoolSize() was given one, libuv's otherwise. libuv reads
+// UV_THREADPOOL_SIZE the same way when it starts its threads.
+static size_t ThreadPoolSize() {
+  if (ThreadPool::Shared().Size() > 0) {
+    return ThreadPool::Shared().Size();
+  }
+
+  const char* value = getenv("UV_THREADPOOL_SIZE");
+
+  if (!value) {
+    return 4;
+  }
+
+  unsigned int size = (unsigned int) atoi(value);
+
+  return std::min<size_t>(size > 0 ? size : 1, MAX_THREAD_POOL_SIZE);
+}
 
 // LOGGING
 // #include <iostream>
@@ -22,16 +477,30 @@ const std::string INVALID_SECOND_ARGUMENT = "Second argument is invalid.";
 
 Napi::Object HunspellBinding::Init(Napi::Env env, Napi::Object exports) {
   Napi::Function func = DefineClass(env, "Hunspell", {
+    StaticMethod("load", &HunspellBinding::load),
+    StaticMethod("compile", &HunspellBinding::compile),
+    StaticMethod("setThreadPoolSize", &HunspellBinding::setThreadPoolSize),
+    StaticMethod("setLoadThreads", &HunspellBinding::setLoadThreads),
     InstanceMethod("addDictionary", &HunspellBinding::addDictionary),
     InstanceMethod("addDictionarySync", &HunspellBinding::addDictionarySync),
     InstanceMethod("spell", &HunspellBinding::spell),
     InstanceMethod("spellSync", &HunspellBinding::spellSync),
+    InstanceMethod("spellBatch", &HunspellBinding::spellBatch),
+    InstanceMethod("spellBatchSync", &HunspellBinding::spellBatchSync),
+    InstanceMethod("checkText", &HunspellBinding::checkText),
+    InstanceMethod("checkTextSync", &HunspellBinding::checkTextSync),
     InstanceMethod("suggest", &HunspellBinding::suggest),
     InstanceMethod("suggestSync", &HunspellBinding::suggestSync),
+    InstanceMethod("suggestBatch", &HunspellBinding::suggestBatch),
+    InstanceMethod("suggestBatchSync", &HunspellBinding::suggestBatchSync),
     InstanceMethod("analyze", &HunspellBinding::analyze),
     InstanceMethod("analyzeSync", &HunspellBinding::analyzeSync),
+    InstanceMethod("analyzeBatch", &HunspellBinding::analyzeBatch),
+    InstanceMethod("analyzeBatchSync", &HunspellBinding::analyzeBatchSync),
     InstanceMethod("stem", &HunspellBinding::stem),
     InstanceMethod("stemSync", &HunspellBinding::stemSync),
+    InstanceMethod("stemBatch", &HunspellBinding::stemBatch),
+    InstanceMethod("stemBatchSync", &HunspellBinding::stemBatchSync),
     InstanceMethod("generate", &HunspellBinding::generate),
     InstanceMethod("generateSync", &HunspellBinding::generateSync),
     InstanceMethod("add", &HunspellBinding::add),
@@ -40,14 +509,22 @@ Napi::Object HunspellBinding::Init(Napi::Env env, Napi::Object exports) {
     InstanceMethod("addWithAffixSync", &HunspellBinding::addWithAffixSync),
     InstanceMethod("remove", &HunspellBinding::remove),
     InstanceMethod("removeSync", &HunspellBinding::removeSync),
-    InstanceMethod("getWordCharacters", &HunspellBinding::getWordCharacters)
+    InstanceMethod("addMany", &HunspellBinding::addMany),
+    InstanceMethod("addManySync", &HunspellBinding::addManySync),
+    InstanceMethod("addManyWithAffix", &HunspellBinding::addManyWithAffix),
+    InstanceMethod("addManyWithAffixSync", &HunspellBinding::addManyWithAffixSync),
+    InstanceMethod("removeMany", &HunspellBinding::removeMany),
+    InstanceMethod("removeManySync", &HunspellBinding::removeManySync),
+    InstanceMethod("getWordCharacters", &HunspellBinding::getWordCharacters),
+    InstanceMethod("getCacheStats", &HunspellBinding::getCacheStats),
+    InstanceMethod("stats", &HunspellBinding::stats)
   });
 
   // Support worker threads
   // See https://github.com/nodejs/node-addon-api/blob/main/doc/object_wrap.md
-  auto* constructor = new Napi::FunctionReference();
-  *constructor = Napi::Persistent(func);
-  env.SetInstanceData<Napi::FunctionReference>(constructor);
+  auto* data = new AddonData();
+  data->constructor = Napi::Persistent(func);
+  env.SetInstanceData<AddonData>(data);
 
   return func;
 }
@@ -55,57 +532,147 @@ Napi::Object HunspellBinding::Init(Napi::Env env, Napi::Object exports) {
 HunspellBinding::HunspellBinding(const Napi::CallbackInfo& info) : Napi::ObjectWrap<HunspellBinding>(info), context(nullptr) {
   Napi::Env env = info.Env();
 
-  std::string affixFile;
-  std::string dictionaryFile;
+  // Created by load(), which passes ownership of a loaded context
+  if (info.Length() == 1 && info[0].IsExternal()) {
+    context = info[0].As<Napi::External<HunspellContext>>().Data();
+    return;
+  }
 
-  if (info.Length() == 1 && info[0].IsObject()) {
-    Napi::Object dictionary = info[0].As<Napi::Object>();
+  uv_loop_t* loop = NULL;
+  napi_get_uv_event_loop(env, &loop);
 
-    if (!dictionary.Has("aff") || !dictionary.Has("dic")) {
-      Napi::TypeError::New(env, INVALID_FIRST_ARGUMENT).ThrowAsJavaScriptException();
-      return;
-    }
+  LoadOptions options;
+  Napi::Error error = ToLoadOptions(info, options);
 
-    Napi::Value aff = dictionary.Get("aff");
-    Napi::Value dic = dictionary.Get("dic");
+  if (!error.IsEmpty()) {
+    error.ThrowAsJavaScriptException();
+    return;
+  }
 
-    if (!aff.IsString() || !dic.IsString()) {
-      Napi::TypeError::New(env, INVALID_FIRST_ARGUMENT).ThrowAsJavaScriptException();
-      return;
-    }
+  context = options.Load(loop);
+};
 
-    affixFile = aff.As<Napi::String>().Utf8Value();
-    dictionaryFile = dic.As<Napi::String>().Utf8Value();
-  } else if (info.Length() == 2) {
-    if (!info[0].IsString()) {
-      Napi::TypeError::New(env, INVALID_FIRST_ARGUMENT).ThrowAsJavaScriptException();
-      return;
-    }
+Napi::Value HunspellBinding::load(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
 
-    if (!info[1].IsString()) {
-      Napi::TypeError::New(env, INVALID_SECOND_ARGUMENT).ThrowAsJavaScriptException();
-      return;
-    }
+  Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+
+  uv_loop_t* loop = NULL;
+  napi_get_uv_event_loop(env, &loop);
+
+  LoadOptions options;
+  Napi::Error error = ToLoadOptions(info, options);
 
-    affixFile = info[0].ToString().Utf8Value();
-    dictionaryFile = info[1].ToString().Utf8Value();
+  Napi::Value signal = env.Undefined();
+
+  if (!error.IsEmpty()) {
+    deferred.Reject(error.Value());
+  } else if (info.Length() == 2 && info[0].IsObject() && !ToSignal(info[1], signal)) {
+    Napi::Error error = Napi::TypeError::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
   } else {
-    Napi::TypeError::New(env, INVALID_NUMBER_OF_ARGUMENTS).ThrowAsJavaScriptException();;
-    return;
+    LoadWorker* worker = new LoadWorker(
+      deferred,
+      loop,
+      std::move(options)
+    );
+
+    worker->Queue(signal);
   }
 
-  context = new HunspellContext(
-    new Hunspell(affixFile.c_str(), dictionaryFile.c_str(), NULL)
-  );
-};
+  return deferred.Promise();
+}
+
+Napi::Value HunspellBinding::compile(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+
+  if (info.Length() != 2) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    deferred.Reject(error.Value());
+    return deferred.Promise();
+  }
+
+  Napi::Object dictionary = info[0].IsObject() ? info[0].As<Napi::Object>() : Napi::Object();
+
+  if (dictionary.IsEmpty() || !IsFile(dictionary.Get("aff")) || !IsFile(dictionary.Get("dic"))) {
+    Napi::Error error = Napi::TypeError::New(env, INVALID_FIRST_ARGUMENT);
+    deferred.Reject(error.Value());
+  } else if (!info[1].IsString()) {
+    Napi::Error error = Napi::TypeError::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
+  } else {
+    CompileWorker* worker = new CompileWorker(
+      deferred,
+      FileArgument(dictionary.Get("aff")),
+      FileArgument(dictionary.Get("dic")),
+      info[1].As<Napi::String>().Utf8Value()
+    );
+
+    worker->Queue(env.Undefined());
+  }
+
+  return deferred.Promise();
+}
+
+Napi::Value HunspellBinding::setThreadPoolSize(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  }
+
+  double size = info[0].IsNumber() ? info[0].As<Napi::Number>().DoubleValue() : -1;
+
+  if (!(size >= 0 && size <= MAX_THREAD_POOL_SIZE) || size != (uint32_t) size) {
+    Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  }
+
+  ThreadPool::Shared().Resize((size_t) size);
+
+  return env.Undefined();
+}
+
+// See patches/008-parallel-dic-loading.patch
+Napi::Value HunspellBinding::setLoadThreads(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() != 1) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  }
+
+  double threads = info[0].IsNumber() ? info[0].As<Napi::Number>().DoubleValue() : -1;
+
+  if (!(threads >= 0 && threads <= MAX_THREAD_POOL_SIZE) || threads != (uint32_t) threads) {
+    Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  }
+
+  Hunspell::set_load_threads((unsigned) threads);
+
+  return env.Undefined();
+}
 
 HunspellBinding::~HunspellBinding() {
   if (context) {
-    delete context;
+    context->Release();
     context = NULL;
   }
 }
 
+// Writes must not affect other instances that share the dictionary
+void HunspellBinding::unshare() {
+  context = context->Unshare();
+}
+
 Napi::Value HunspellBinding::addDictionarySync(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
@@ -113,14 +680,20 @@ Napi::Value HunspellBinding::addDictionarySync(const Napi::CallbackInfo& info) {
     Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
     error.ThrowAsJavaScriptException();
     return error.Value();
-  } else if (!info[0].IsString()) {
+  } else if (!IsFile(info[0])) {
     Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
     error.ThrowAsJavaScriptException();
     return error.Value();
   } else {
-    std::string dictionary = info[0].ToString().Utf8Value();
+    FileArgument file(info[0]);
+    std::unique_ptr<MemoryFile> memory;
+    std::string dictionary = file.Open(memory, false);
+
+    unshare();
 
-    context->instance->add_dic(dictionary.c_str());
+    context->write(Stats::ADD, [&](Hunspell* instance) {
+      HunspellContext::AddDictionary(instance, dictionary);
+    });
 
     return env.Undefined();
   }
@@ -130,23 +703,27 @@ Napi::Value HunspellBinding::addDictionary(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
   Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(info.Env());
+  Napi::Value signal = env.Undefined();
 
-  if (info.Length() != 1) {
+  if (info.Length() != 1 && info.Length() != 2) {
     Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
     deferred.Reject(error.Value());
-    } else if (!info[0].IsString()) {
+  } else if (!IsFile(info[0])) {
     Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
     deferred.Reject(error.Value());
+  } else if (!ToSignal(info[1], signal)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
   } else {
-    std::string dictionary = info[0].ToString().Utf8Value();
+    unshare();
 
     AddDictionaryWorker* worker = new AddDictionaryWorker(
       context,
       deferred,
-      dictionary
+      FileArgument(info[0])
     );
 
-    worker->Queue();
+    worker->Queue(signal);
   }
 
   return deferred.Promise();
@@ -156,23 +733,27 @@ Napi::Value HunspellBinding::spell(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
   Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+  Napi::Value signal = env.Undefined();
 
-  if (info.Length() != 1) {
+  if (info.Length() != 1 && info.Length() != 2) {
     Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
     deferred.Reject(error.Value());
   } else if (!info[0].IsString()) {
     Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
     deferred.Reject(error.Value());
+  } else if (!ToSignal(info[1], signal)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
   } else {
-    std::string word = info[0].ToString().Utf8Value();
+    std::string word = ToWord(info[0]);
 
     SpellWorker* worker = new SpellWorker(
       context,
       deferred,
-      word
+      std::move(word)
     );
 
-    worker->Queue();
+    worker->Queue(signal);
   }
 
   return deferred.Promise();
@@ -190,13 +771,160 @@ Napi::Value HunspellBinding::spellSync(const Napi::CallbackInfo& info) {
     error.ThrowAsJavaScriptException();
     return error.Value();
   } else {
-    std::string word = info[0].ToString().Utf8Value();
+    std::string word = ToWord(info[0]);
+
+    Hunspell* instance = context->acquire(Stats::SPELL);
+    bool correct = context->spell(instance, word);
+    context->release(instance);
+
+    return Napi::Boolean::New(env, correct);
+  }
+}
+
+Napi::Value HunspellBinding::spellBatch(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+  Napi::Value signal = env.Undefined();
+  std::vector<std::string> words;
+
+  if (info.Length() != 1 && info.Length() != 2) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    deferred.Reject(error.Value());
+  } else if (!ToStringVector(info[0], words)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
+    deferred.Reject(error.Value());
+  } else if (!ToSignal(info[1], signal)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
+  } else {
+    SpellBatchWorker* worker = new SpellBatchWorker(
+      context,
+      deferred,
+      std::move(words)
+    );
+
+    worker->Queue(signal);
+  }
+
+  return deferred.Promise();
+}
+
+Napi::Value HunspellBinding::spellBatchSync(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  std::vector<std::string> words;
+
+  if (info.Length() != 1) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  } else if (!ToStringVector(info[0], words)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  } else {
+    Napi::Uint8Array array = Napi::Uint8Array::New(env, words.size());
+
+    Hunspell* instance = context->acquire(Stats::SPELL);
+    for (size_t i = 0; i < words.size(); i++) {
+      if (i + 1 < words.size()) context->prefetch(words[i + 1]);
+      array[i] = context->spell(instance, words[i]) ? 1 : 0;
+    }
+    context->release(instance);
+
+    return array;
+  }
+}
+
+Napi::Value HunspellBinding::checkText(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+  Napi::Value signal = env.Undefined();
+  std::string wordCharacters;
+
+  if (info.Length() != 1 && info.Length() != 2) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    deferred.Reject(error.Value());
+  } else if (!info[0].IsString() && !IsUint8Array(info[0])) {
+    Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
+    deferred.Reject(error.Value());
+  } else if (!ToWordCharacters(info[1], context, wordCharacters)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
+  } else if (!ToSignal(info[1], signal)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
+  } else {
+    std::string text;
+
+    // Copy because the buffer may be modified while the worker runs
+    if (info[0].IsString()) {
+      text = info[0].As<Napi::String>().Utf8Value();
+    } else {
+      Napi::Uint8Array buffer = info[0].As<Napi::Uint8Array>();
+      text.assign((const char*) buffer.Data(), buffer.ByteLength());
+    }
+
+    CheckTextWorker* worker = new CheckTextWorker(
+      context,
+      deferred,
+      std::move(text),
+      Tokenizer(wordCharacters)
+    );
+
+    worker->Queue(signal);
+  }
+
+  return deferred.Promise();
+}
+
+Napi::Value HunspellBinding::checkTextSync(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  std::string wordCharacters;
+
+  if (info.Length() != 1 && info.Length() != 2) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  } else if (!info[0].IsString() && !IsUint8Array(info[0])) {
+    Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  } else if (!ToWordCharacters(info[1], context, wordCharacters)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  } else {
+    std::vector<uint32_t> ranges;
+    std::string text;
+    const char* data;
+    size_t length;
+
+    if (info[0].IsString()) {
+      text = info[0].As<Napi::String>().Utf8Value();
+      data = text.data();
+      length = text.size();
+    } else {
+      Napi::Uint8Array buffer = info[0].As<Napi::Uint8Array>();
+      data = (const char*) buffer.Data();
+      length = buffer.ByteLength();
+    }
 
-    context->lockRead();
-    bool correct = context->instance->spell(word);
-    context->unlockRead();
+    Tokenizer tokenizer(wordCharacters);
 
-    return Napi::Boolean::New(env, correct);
+    Hunspell* instance = context->acquire(Stats::SPELL);
+    CheckTextWorker::Check(context, instance, tokenizer, data, length, ranges);
+    context->release(instance);
+
+    Napi::Uint32Array array = Napi::Uint32Array::New(env, ranges.size());
+    if (!ranges.empty()) {
+      memcpy(array.Data(), ranges.data(), ranges.size() * sizeof(uint32_t));
+    }
+
+    return array;
   }
 }
 
@@ -204,23 +932,33 @@ Napi::Value HunspellBinding::suggest(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
   Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+  Napi::Value signal = env.Undefined();
 
-  if (info.Length() != 1) {
+  SuggestLimits limits;
+
+  if (info.Length() != 1 && info.Length() != 2) {
     Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
     deferred.Reject(error.Value());
   } else if (!info[0].IsString()) {
     Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
     deferred.Reject(error.Value());
+  } else if (!ToSuggestLimits(info[1], limits, context->index != NULL)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
+  } else if (!ToSignal(info[1], signal)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
   } else {
-    std::string word = info[0].ToString().Utf8Value();
+    std::string word = ToWord(info[0]);
 
     SuggestWorker* worker = new SuggestWorker(
       context,
       deferred,
-      word
+      std::move(word),
+      limits
     );
 
-    worker->Queue();
+    worker->Queue(signal);
   }
 
   return deferred.Promise();
@@ -229,7 +967,9 @@ Napi::Value HunspellBinding::suggest(const Napi::CallbackInfo& info) {
 Napi::Value HunspellBinding::suggestSync(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
-  if (info.Length() != 1) {
+  SuggestLimits limits;
+
+  if (info.Length() != 1 && info.Length() != 2) {
     Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
     error.ThrowAsJavaScriptException();
     return error.Value();
@@ -237,51 +977,66 @@ Napi::Value HunspellBinding::suggestSync(const Napi::CallbackInfo& info) {
     Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
     error.ThrowAsJavaScriptException();
     return error.Value();
+  } else if (!ToSuggestLimits(info[1], limits, context->index != NULL)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
   } else {
-    std::string word = info[0].ToString().Utf8Value();
+    std::string word = ToWord(info[0]);
 
-    context->lockRead();
-    bool isCorrect = this->context->instance->spell(word);
+    std::vector<std::string> suggestions;
+    bool timedOut = false;
+    Hunspell* instance = context->acquire(Stats::SUGGEST);
+    bool isCorrect = context->suggest(instance, word, suggestions, limits, &timedOut);
+    context->release(instance);
 
     if (isCorrect) {
-      context->unlockRead();
       return env.Null();
     }
 
-    std::vector<std::string> suggestions = this->context->instance->suggest(word);
-    size_t length = suggestions.size();
-    context->unlockRead();
+    Napi::Object packed = PackStrings(env, suggestions);
 
-    Napi::Array array = Napi::Array::New(env, length);
-    for (int i = 0; i < length; i++) {
-      array.Set(i, Napi::String::New(env, suggestions[i]));
+    if (timedOut) {
+      packed.Set("timedOut", true);
     }
 
-    return array;
+    return packed;
   }
 }
 
+Napi::Value HunspellBinding::suggestBatch(const Napi::CallbackInfo& info) {
+  return lookupBatch(info, Stats::SUGGEST);
+}
+
+Napi::Value HunspellBinding::suggestBatchSync(const Napi::CallbackInfo& info) {
+  return lookupBatchSync(info, Stats::SUGGEST);
+}
+
 Napi::Value HunspellBinding::analyze(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
   Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+  Napi::Value signal = env.Undefined();
 
-  if (info.Length() != 1) {
+  if (info.Length() != 1 && info.Length() != 2) {
     Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
     deferred.Reject(error.Value());
   } else if (!info[0].IsString()) {
     Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
     deferred.Reject(error.Value());
+  } else if (!ToSignal(info[1], signal)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
   } else {
-    std::string word = info[0].ToString().Utf8Value();
+    std::string word = ToWord(info[0]);
 
     AnalyzeWorker* worker = new AnalyzeWorker(
       context,
       deferred,
-      word
+      std::move(word)
     );
 
-    worker->Queue();
+    worker->Queue(signal);
   }
 
   return deferred.Promise();
@@ -299,21 +1054,13 @@ Napi::Value HunspellBinding::analyzeSync(const Napi::CallbackInfo& info) {
     error.ThrowAsJavaScriptException();
     return error.Value();
   } else {
-    std::string word = info[0].ToString().Utf8Value();
-
-    char** analysis = NULL;
-    this->context->lockRead();
-    int length = this->context->instance->analyze(&analysis, word.c_str());
-    this->context->unlockRead();
-
-    Napi::Array array = Napi::Array::New(env, length);
-    for (int i = 0; i < length; i++) {
-      array.Set(i, Napi::String::New(env, analysis[i]));
-    }
+    std::string word = ToWord(info[0]);
 
-    context->instance->free_list(&analysis, length);
+    Hunspell* instance = context->acquire(Stats::ANALYZE);
+    std::vector<std::string> analysis = context->analyze(instance, word);
+    context->release(instance);
 
-    return array;
+    return PackStrings(env, analysis);
   }
 }
 
@@ -321,23 +1068,27 @@ Napi::Value HunspellBinding::stem(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
   Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+  Napi::Value signal = env.Undefined();
 
-  if (info.Length() != 1) {
+  if (info.Length() != 1 && info.Length() != 2) {
     Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
     deferred.Reject(error.Value());
   } else if (!info[0].IsString()) {
     Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
     deferred.Reject(error.Value());
+  } else if (!ToSignal(info[1], signal)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
   } else {
-    std::string word = info[0].ToString().Utf8Value();
+    std::string word = ToWord(info[0]);
 
     StemWorker* worker = new StemWorker(
       context,
       deferred,
-      word
+      std::move(word)
     );
 
-    worker->Queue();
+    worker->Queue(signal);
   }
 
   return deferred.Promise();
@@ -355,21 +1106,13 @@ Napi::Value HunspellBinding::stemSync(const Napi::CallbackInfo& info) {
     error.ThrowAsJavaScriptException();
     return error.Value();
   } else {
-    std::string word = info[0].ToString().Utf8Value();
-
-    char** stems = NULL;
-    context->lockRead();
-    int length = this->context->instance->stem(&stems, word.c_str());
-    context->unlockRead();
-
-    Napi::Array array = Napi::Array::New(env, length);
-    for (int i = 0; i < length; i++) {
-      array.Set(i, Napi::String::New(env, stems[i]));
-    }
+    std::string word = ToWord(info[0]);
 
-    context->instance->free_list(&stems, length);
+    Hunspell* instance = context->acquire(Stats::STEM);
+    std::vector<std::string> stems = context->stem(instance, word);
+    context->release(instance);
 
-    return array;
+    return PackStrings(env, stems);
   }
 }
 
@@ -377,8 +1120,9 @@ Napi::Value HunspellBinding::generate(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
   Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+  Napi::Value signal = env.Undefined();
 
-  if (info.Length() != 2) {
+  if (info.Length() != 2 && info.Length() != 3) {
     Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
     deferred.Reject(error.Value());
   } else if (!info[0].IsString()) {
@@ -387,18 +1131,21 @@ Napi::Value HunspellBinding::generate(const Napi::CallbackInfo& info) {
   } else if (!info[1].IsString()) {
     Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
     deferred.Reject(error.Value());
+  } else if (!ToSignal(info[2], signal)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_THIRD_ARGUMENT);
+    deferred.Reject(error.Value());
   } else {
-    std::string word = info[0].ToString().Utf8Value();
-    std::string example = info[1].ToString().Utf8Value();
+    std::string word = ToWord(info[0]);
+    std::string example = ToWord(info[1]);
 
     GenerateWorker* worker = new GenerateWorker(
       context,
       deferred,
-      word,
-      example
+      std::move(word),
+      std::move(example)
     );
 
-    worker->Queue();
+    worker->Queue(signal);
   }
 
   return deferred.Promise();
@@ -420,26 +1167,14 @@ Napi::Value HunspellBinding::generateSync(const Napi::CallbackInfo& info) {
     error.ThrowAsJavaScriptException();
     return error.Value();
   } else {
-    std::string word = info[0].ToString().Utf8Value();
-    std::string example = info[1].ToString().Utf8Value();
-
-    char** generates = NULL;
-    context->lockRead();
-    int length = this->context->instance->generate(
-      &generates,
-      word.c_str(),
-      example.c_str()
-    );
-    context->unlockRead();
-
-    Napi::Array array = Napi::Array::New(env, length);
-    for (int i = 0; i < length; i++) {
-      array.Set(i, Napi::String::New(env, generates[i]));
-    }
+    std::string word = ToWord(info[0]);
+    std::string example = ToWord(info[1]);
 
-    context->instance->free_list(&generates, length);
+    Hunspell* instance = context->acquire(Stats::GENERATE);
+    std::vector<std::string> generates = instance->generate(word, example);
+    context->release(instance);
 
-    return array;
+    return PackStrings(env, generates);
   }
 }
 
@@ -457,11 +1192,13 @@ Napi::Value HunspellBinding::addSync(const Napi::CallbackInfo& info) {
 
     return error.Value();
   } else {
-    std::string word = info[0].ToString().Utf8Value();
+    std::string word = ToWord(info[0]);
 
-    context->lockWrite();
-    context->instance->add(word.c_str());
-    context->unlockWrite();
+    unshare();
+
+    context->write(Stats::ADD, [&](Hunspell* instance) {
+      instance->add(word.c_str());
+    });
 
     return env.Undefined();
   }
@@ -472,23 +1209,29 @@ Napi::Value HunspellBinding::add(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
   Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(info.Env());
+  Napi::Value signal = env.Undefined();
 
-  if (info.Length() != 1) {
+  if (info.Length() != 1 && info.Length() != 2) {
     Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
     deferred.Reject(error.Value());
   } else if (!info[0].IsString()) {
     Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
     deferred.Reject(error.Value());
+  } else if (!ToSignal(info[1], signal)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
   } else {
-    std::string word = info[0].ToString().Utf8Value();
+    std::string word = ToWord(info[0]);
+
+    unshare();
 
     AddWorker* worker = new AddWorker(
       context,
       deferred,
-      word
+      std::move(word)
     );
 
-    worker->Queue();
+    worker->Queue(signal);
   }
 
   return deferred.Promise();
@@ -513,12 +1256,14 @@ Napi::Value HunspellBinding::addWithAffixSync(const Napi::CallbackInfo& info) {
 
     return error.Value();
   } else {
-    std::string word = info[0].ToString().Utf8Value();
-    std::string example = info[1].ToString().Utf8Value();
+    std::string word = ToWord(info[0]);
+    std::string example = ToWord(info[1]);
+
+    unshare();
 
-    context->lockWrite();
-    context->instance->add_with_affix(word.c_str(), example.c_str());
-    context->unlockWrite();
+    context->write(Stats::ADD, [&](Hunspell* instance) {
+      instance->add_with_affix(word.c_str(), example.c_str());
+    });
 
     return env.Undefined();
   }
@@ -529,8 +1274,9 @@ Napi::Value HunspellBinding::addWithAffix(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
   Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(info.Env());
+  Napi::Value signal = env.Undefined();
 
-  if (info.Length() != 2) {
+  if (info.Length() != 2 && info.Length() != 3) {
     Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
     deferred.Reject(error.Value());
   } else if (!info[0].IsString()) {
@@ -539,18 +1285,23 @@ Napi::Value HunspellBinding::addWithAffix(const Napi::CallbackInfo& info) {
   } else if (!info[1].IsString()) {
     Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
     deferred.Reject(error.Value());
+  } else if (!ToSignal(info[2], signal)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_THIRD_ARGUMENT);
+    deferred.Reject(error.Value());
   } else {
-    std::string word = info[0].ToString().Utf8Value();
-    std::string example = info[1].ToString().Utf8Value();
+    std::string word = ToWord(info[0]);
+    std::string example = ToWord(info[1]);
+
+    unshare();
 
     AddWithAffixWorker* worker = new AddWithAffixWorker(
       context,
       deferred,
-      word,
-      example
+      std::move(word),
+      std::move(example)
     );
 
-    worker->Queue();
+    worker->Queue(signal);
   }
 
   return deferred.Promise();
@@ -570,11 +1321,13 @@ Napi::Value HunspellBinding::removeSync(const Napi::CallbackInfo& info) {
 
     return error.Value();
   } else {
-    std::string word = info[0].ToString().Utf8Value();
+    std::string word = ToWord(info[0]);
+
+    unshare();
 
-    context->lockWrite();
-    context->instance->remove(word.c_str());
-    context->unlockWrite();
+    context->write(Stats::REMOVE, [&](Hunspell* instance) {
+      instance->remove(word.c_str());
+    });
 
     return env.Undefined();
   }
@@ -585,23 +1338,200 @@ Napi::Value HunspellBinding::remove(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
 
   Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(info.Env());
+  Napi::Value signal = env.Undefined();
 
-  if (info.Length() != 1) {
+  if (info.Length() != 1 && info.Length() != 2) {
     Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
     deferred.Reject(error.Value());
   } else if (!info[0].IsString()) {
     Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
     deferred.Reject(error.Value());
+  } else if (!ToSignal(info[1], signal)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
   } else {
-    std::string word = info[0].ToString().Utf8Value();
+    std::string word = ToWord(info[0]);
+
+    unshare();
 
     RemoveWorker* worker = new RemoveWorker(
       context,
       deferred,
-      word
+      std::move(word)
+    );
+
+    worker->Queue(signal);
+  }
+
+  return deferred.Promise();
+}
+
+Napi::Value HunspellBinding::addManySync(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  std::vector<std::string> words;
+
+  if (info.Length() != 1) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  } else if (!ToStringVector(info[0], words)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  } else {
+    unshare();
+
+    context->write(Stats::ADD, [&](Hunspell* instance) {
+      for (const std::string& word : words) {
+        instance->add(word);
+      }
+    });
+
+    return env.Undefined();
+  }
+}
+
+Napi::Value HunspellBinding::addMany(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+  Napi::Value signal = env.Undefined();
+  std::vector<std::string> words;
+
+  if (info.Length() != 1 && info.Length() != 2) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    deferred.Reject(error.Value());
+  } else if (!ToStringVector(info[0], words)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
+    deferred.Reject(error.Value());
+  } else if (!ToSignal(info[1], signal)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
+  } else {
+    unshare();
+
+    AddManyWorker* worker = new AddManyWorker(
+      context,
+      deferred,
+      std::move(words)
+    );
+
+    worker->Queue(signal);
+  }
+
+  return deferred.Promise();
+}
+
+Napi::Value HunspellBinding::addManyWithAffixSync(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  std::vector<std::pair<std::string, std::string>> pairs;
+
+  if (info.Length() != 1) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  } else if (!ToStringPairs(info[0], pairs)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  } else {
+    unshare();
+
+    context->write(Stats::ADD, [&](Hunspell* instance) {
+      for (const auto& pair : pairs) {
+        instance->add_with_affix(pair.first, pair.second);
+      }
+    });
+
+    return env.Undefined();
+  }
+}
+
+Napi::Value HunspellBinding::addManyWithAffix(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+  Napi::Value signal = env.Undefined();
+  std::vector<std::pair<std::string, std::string>> pairs;
+
+  if (info.Length() != 1 && info.Length() != 2) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    deferred.Reject(error.Value());
+  } else if (!ToStringPairs(info[0], pairs)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
+    deferred.Reject(error.Value());
+  } else if (!ToSignal(info[1], signal)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
+  } else {
+    unshare();
+
+    AddManyWithAffixWorker* worker = new AddManyWithAffixWorker(
+      context,
+      deferred,
+      std::move(pairs)
+    );
+
+    worker->Queue(signal);
+  }
+
+  return deferred.Promise();
+}
+
+Napi::Value HunspellBinding::removeManySync(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  std::vector<std::string> words;
+
+  if (info.Length() != 1) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  } else if (!ToStringVector(info[0], words)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  } else {
+    unshare();
+
+    context->write(Stats::REMOVE, [&](Hunspell* instance) {
+      for (const std::string& word : words) {
+        instance->remove(word);
+      }
+    });
+
+    return env.Undefined();
+  }
+}
+
+Napi::Value HunspellBinding::removeMany(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+  Napi::Value signal = env.Undefined();
+  std::vector<std::string> words;
+
+  if (info.Length() != 1 && info.Length() != 2) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    deferred.Reject(error.Value());
+  } else if (!ToStringVector(info[0], words)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
+    deferred.Reject(error.Value());
+  } else if (!ToSignal(info[1], signal)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
+  } else {
+    unshare();
+
+    RemoveManyWorker* worker = new RemoveManyWorker(
+      context,
+      deferred,
+      std::move(words)
     );
 
-    worker->Queue();
+    worker->Queue(signal);
   }
 
   return deferred.Promise();
@@ -616,7 +1546,7 @@ Napi::Value HunspellBinding::getWordCharacters(const Napi::CallbackInfo& info) {
     return error.Value();
   }
 
-  const std::string wordCharacters = this->context->instance->get_wordchars_cpp();
+  const std::string& wordCharacters = this->context->wordCharacters;
 
   if (wordCharacters.empty()) {
     return env.Undefined();
@@ -624,3 +1554,176 @@ Napi::Value HunspellBinding::getWordCharacters(const Napi::CallbackInfo& info) {
     return Napi::String::New(env, wordCharacters);
   }
 }
+
+Napi::Value HunspellBinding::getCacheStats(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() > 0) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  }
+
+  Cache<CachedResult>* cache = context->cache;
+
+  if (!cache) {
+    return env.Undefined();
+  }
+
+  Napi::Object stats = Napi::Object::New(env);
+  stats.Set("hits", Napi::Number::New(env, (double) cache->hits));
+  stats.Set("misses", Napi::Number::New(env, (double) cache->misses));
+  stats.Set("size", Napi::Number::New(env, (double) cache->size()));
+  stats.Set("capacity", Napi::Number::New(env, (double) cache->capacity));
+
+  return stats;
+}
+
+Napi::Value HunspellBinding::stats(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if (info.Length() > 0) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  }
+
+  Stats& stats = context->stats;
+  Napi::Object operations = Napi::Object::New(env);
+
+  for (int i = 0; i < Stats::OPERATIONS; i++) {
+    Stats::Operation operation = (Stats::Operation) i;
+    Stats::Counters& counters = stats.Of(operation);
+    Napi::Object object = Napi::Object::New(env);
+
+    object.Set("calls", Napi::Number::New(env, (double) counters.calls));
+    object.Set("inFlight", Napi::Number::New(env, (double) counters.inFlight));
+    object.Set("queueWait", ToHistogram(env, counters.queueWait));
+    object.Set("execute", ToHistogram(env, counters.execute));
+    object.Set("lockWait", ToHistogram(env, counters.lockWait));
+
+    operations.Set(Stats::Name(operation), object);
+  }
+
+  Napi::Object memory = Napi::Object::New(env);
+  memory.Set("instances", Napi::Number::New(env, (double) stats.memory.instances));
+  memory.Set("hashTables", Napi::Number::New(env, (double) stats.memory.hashTables));
+  memory.Set("entries", Napi::Number::New(env, (double) stats.memory.entries));
+  memory.Set("descriptions", Napi::Number::New(env, (double) stats.memory.descriptions));
+  memory.Set("suggestIndex", Napi::Number::New(env, (double) stats.memory.suggestIndex));
+  memory.Set("wordStore", Napi::Number::New(env, (double) stats.memory.wordStore));
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("memory", Napi::Number::New(env, (double) stats.memory.Total()));
+  result.Set("memoryByStructure", memory);
+  result.Set("operations", operations);
+
+  return result;
+}
+
+Napi::Value HunspellBinding::analyzeBatch(const Napi::CallbackInfo& info) {
+  return lookupBatch(info, Stats::ANALYZE);
+}
+
+Napi::Value HunspellBinding::analyzeBatchSync(const Napi::CallbackInfo& info) {
+  return lookupBatchSync(info, Stats::ANALYZE);
+}
+
+Napi::Value HunspellBinding::stemBatch(const Napi::CallbackInfo& info) {
+  return lookupBatch(info, Stats::STEM);
+}
+
+Napi::Value HunspellBinding::stemBatchSync(const Napi::CallbackInfo& info) {
+  return lookupBatchSync(info, Stats::STEM);
+}
+
+Napi::Value HunspellBinding::lookupBatch(const Napi::CallbackInfo& info, Stats::Operation operation) {
+  Napi::Env env = info.Env();
+
+  Napi::Promise::Deferred deferred = Napi::Promise::Deferred::New(env);
+  Napi::Value signal = env.Undefined();
+  std::shared_ptr<Batch> batch;
+
+  SuggestLimits limits;
+
+  // A batch is spread over the whole threadpool unless told otherwise
+  size_t parallelism = ThreadPoolSize();
+
+  if (info.Length() != 1 && info.Length() != 2) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    deferred.Reject(error.Value());
+  } else if (!(batch = ToBatch(info[0]))) {
+    Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
+    deferred.Reject(error.Value());
+  } else if ((operation == Stats::SUGGEST && !ToSuggestLimits(info[1], limits, context->index != NULL)) ||
+             !ToParallelism(info[1], parallelism) ||
+             !ToSignal(info[1], signal)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    deferred.Reject(error.Value());
+  } else {
+    batch->hasCorrect = operation == Stats::SUGGEST;
+
+    BatchWorker* worker = new BatchWorker(
+      context,
+      deferred,
+      operation,
+      batch,
+      limits,
+      true
+    );
+
+    worker->Queue(signal);
+
+    // More threads than the pool has would queue behind each other. With
+    // several instances, more threads than instances would wait in acquire(),
+    // holding pool threads; with one, they share it like other reads do.
+    parallelism = std::min(parallelism, ThreadPoolSize());
+
+    if (context->concurrency > 1) {
+      parallelism = std::min(parallelism, context->concurrency);
+    }
+
+    // Helpers take words as soon as they start. If the primary worker is
+    // aborted before then, they find the batch cancelled.
+    for (size_t i = 1; i < parallelism && i < batch->words.size(); i++) {
+      BatchWorker* helper = new BatchWorker(
+        context,
+        Napi::Promise::Deferred::New(env),
+        operation,
+        batch,
+        limits,
+        false
+      );
+
+      helper->Queue(env.Undefined());
+    }
+  }
+
+  return deferred.Promise();
+}
+
+Napi::Value HunspellBinding::lookupBatchSync(const Napi::CallbackInfo& info, Stats::Operation operation) {
+  Napi::Env env = info.Env();
+
+  std::shared_ptr<Batch> batch;
+  SuggestLimits limits;
+
+  if (info.Length() != 1 && info.Length() != (operation == Stats::SUGGEST ? 2 : 1)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_NUMBER_OF_ARGUMENTS);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  } else if (!(batch = ToBatch(info[0]))) {
+    Napi::Error error = Napi::Error::New(env, INVALID_FIRST_ARGUMENT);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  } else if (operation == Stats::SUGGEST && !ToSuggestLimits(info[1], limits, context->index != NULL)) {
+    Napi::Error error = Napi::Error::New(env, INVALID_SECOND_ARGUMENT);
+    error.ThrowAsJavaScriptException();
+    return error.Value();
+  } else {
+    batch->hasCorrect = operation == Stats::SUGGEST;
+    BatchWorker::Run(context, *batch, operation, limits);
+
+    return batch->ToObject(env);
+  }
+}
\ No newline at end of file
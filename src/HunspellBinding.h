@@ -12,9 +12,27 @@ public:
   HunspellBinding(const Napi::CallbackInfo& info);
   ~HunspellBinding();
 
+  // (dictionary: object, options?: object) => Hunspell
+  static Napi::Value load(const Napi::CallbackInfo& info);
+
+  // (dictionary: object, output: string) => Promise<void>
+  static Napi::Value compile(const Napi::CallbackInfo& info);
+
+  // (size: number) => void
+  static Napi::Value setThreadPoolSize(const Napi::CallbackInfo& info);
+
+  // (threads: number) => void
+  static Napi::Value setLoadThreads(const Napi::CallbackInfo& info);
+
 private:
   HunspellContext* context;
 
+  void unshare();
+
+  // Look up a batch of words, for suggestBatch(), stemBatch() and analyzeBatch()
+  Napi::Value lookupBatch(const Napi::CallbackInfo& info, Stats::Operation operation);
+  Napi::Value lookupBatchSync(const Napi::CallbackInfo& info, Stats::Operation operation);
+
   // (dictionary: string) => void
   Napi::Value addDictionary(const Napi::CallbackInfo& info);
   Napi::Value addDictionarySync(const Napi::CallbackInfo& info);
@@ -23,18 +41,38 @@ private:
   Napi::Value spell(const Napi::CallbackInfo& info);
   Napi::Value spellSync(const Napi::CallbackInfo& info);
 
-  // (word: string) => string[] | null
+  // (words: string[]) => Uint8Array
+  Napi::Value spellBatch(const Napi::CallbackInfo& info);
+  Napi::Value spellBatchSync(const Napi::CallbackInfo& info);
+
+  // (text: string | Uint8Array, options?: object) => Uint32Array
+  Napi::Value checkText(const Napi::CallbackInfo& info);
+  Napi::Value checkTextSync(const Napi::CallbackInfo& info);
+
+  // (word: string, options?: object) => string[] | null
   Napi::Value suggest(const Napi::CallbackInfo& info);
   Napi::Value suggestSync(const Napi::CallbackInfo& info);
 
+  // (words: string[] | object, options?: object) => packed results
+  Napi::Value suggestBatch(const Napi::CallbackInfo& info);
+  Napi::Value suggestBatchSync(const Napi::CallbackInfo& info);
+
   // (word: string) => string[]
   Napi::Value analyze(const Napi::CallbackInfo& info);
   Napi::Value analyzeSync (const Napi::CallbackInfo& info);
 
+  // (words: string[] | object, options?: object) => packed results
+  Napi::Value analyzeBatch(const Napi::CallbackInfo& info);
+  Napi::Value analyzeBatchSync(const Napi::CallbackInfo& info);
+
   // (word: string) => string[]
   Napi::Value stem(const Napi::CallbackInfo& info);
   Napi::Value stemSync(const Napi::CallbackInfo& info);
 
+  // (words: string[] | object, options?: object) => packed results
+  Napi::Value stemBatch(const Napi::CallbackInfo& info);
+  Napi::Value stemBatchSync(const Napi::CallbackInfo& info);
+
   // (word: string, example: string) => string[]
   Napi::Value generate(const Napi::CallbackInfo& info);
   Napi::Value generateSync(const Napi::CallbackInfo& info);
@@ -51,8 +89,26 @@ private:
   Napi::Value remove(const Napi::CallbackInfo& info);
   Napi::Value removeSync(const Napi::CallbackInfo& info);
 
+  // (words: string[]) => void
+  Napi::Value addMany(const Napi::CallbackInfo& info);
+  Napi::Value addManySync(const Napi::CallbackInfo& info);
+
+  // (pairs: [word: string, example: string][]) => void
+  Napi::Value addManyWithAffix(const Napi::CallbackInfo& info);
+  Napi::Value addManyWithAffixSync(const Napi::CallbackInfo& info);
+
+  // (words: string[]) => void
+  Napi::Value removeMany(const Napi::CallbackInfo& info);
+  Napi::Value removeManySync(const Napi::CallbackInfo& info);
+
   // () => string | undefined
   Napi::Value getWordCharacters(const Napi::CallbackInfo& info);
+
+  // () => { hits, misses, size, capacity } | undefined
+  Napi::Value getCacheStats(const Napi::CallbackInfo& info);
+
+  // () => { memory, operations }
+  Napi::Value stats(const Napi::CallbackInfo& info);
 };
 
 #endif
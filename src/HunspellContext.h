@@ -1,50 +1,904 @@
 #ifndef HunspellContext_H
 #define HunspellContext_H
 
+#include <dicfile.hxx>
 #include <hunspell.hxx>
 #include <napi.h>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 #include <uv.h>
+#include "Cache.h"
+#include "DictionaryFile.h"
+#include "MappedFile.h"
+#include "MemoryFile.h"
+#include "QuickSuggester.h"
+#include "SuggestIndex.h"
+#include "WordStore.h"
+#include "Stats.h"
+
+struct CachedResult {
+  bool correct = false;
+  std::vector<std::string> words;
+};
 
 class HunspellContext {
 public:
-  Hunspell* instance;
+  // Characters of the affix file's WORDCHARS
+  const std::string wordCharacters;
 
-  HunspellContext(Hunspell* instance): instance(instance) {
-    uv_rwlock_init(&rwLock);
-  };
+  // Number of instances readers can use at the same time
+  const size_t concurrency;
 
-  ~HunspellContext() {
-    if (instance) {
+  // Whether reads go to a copy of the instances while writes update the other
+  const bool lockFreeReads;
+
+  const std::string affixFile;
+  const std::string dictionaryFile;
+
+  // Backs the affix file if it was given as a buffer, because Hunspell reads
+  // it again when adding a dictionary
+  std::shared_ptr<const MemoryFile> affixMemory;
+
+  // Results of reads, if enabled. Cleared by writes.
+  Cache<CachedResult>* cache = NULL;
+
+  const QuickSuggester quickSuggester;
+
+  // Words of the dictionary file by their deletions, if enabled
+  const SuggestIndex* index = NULL;
+
+  // Correct words of the dictionary file, if enabled. Used until the first
+  // write, after which Hunspell may disagree with it.
+  const WordStore* wordStore = NULL;
+
+  // Counters of the operations on this context, by any object sharing it
+  Stats stats;
+
+  // The context whose dictionary this one's instances look words up in, if
+  // this is an overlay (see Unshare())
+  HunspellContext* const base = NULL;
+
+  /*
+   * Load a dictionary into a new context, with one Hunspell instance per
+   * unit of concurrency, twice over for lock-free reads, and optionally a
+   * SuggestIndex and a WordStore. The dictionary file may be compiled (see
+   * Compile()), in which case it's mapped and its words decoded instead of
+   * parsed. The context takes over the memory file of the affix file, if any.
+   * The caller owns the only reference.
+   */
+  static HunspellContext* Load(
+    const std::string& affixFile,
+    const std::string& dictionaryFile,
+    uint32_t concurrency,
+    size_t cacheSize,
+    bool lockFreeReads,
+    bool suggestIndex,
+    bool wordStore,
+    std::unique_ptr<MemoryFile> affixMemory = nullptr) {
+    std::vector<Hunspell*> instances;
+    uint32_t count = lockFreeReads ? concurrency * 2 : concurrency;
+    size_t before = 0;
+    size_t after = 0;
+
+    MappedFile mapped(dictionaryFile);
+    bool compiled = DicFile::is_compiled(mapped.data, mapped.length);
+
+    // The words for the addon's own structures are read, and the index
+    // built, on another thread while Hunspell loads, as neither uses it
+    std::vector<std::string> words;
+    SuggestIndex* index = NULL;
+    std::thread builder;
+
+    if (suggestIndex || wordStore) {
+      builder = std::thread([&]() {
+        if (compiled) {
+          DicFile::words(mapped.data, mapped.length, words);
+        } else {
+          words = DictionaryFile::Words(dictionaryFile);
+        }
+
+        if (suggestIndex) {
+          index = new SuggestIndex(words);
+        }
+      });
+    }
+
+    uv_resident_set_memory(&before);
+
+    for (uint32_t i = 0; i < count; i++) {
+      std::lock_guard<std::mutex> guard(LoadMutex());
+
+      instances.push_back(NewInstance(affixFile, dictionaryFile, compiled ? &mapped : NULL));
+    }
+
+    if (builder.joinable()) {
+      builder.join();
+    }
+
+    uv_resident_set_memory(&after);
+
+    HunspellContext* context = new HunspellContext(affixFile, dictionaryFile, instances, cacheSize, lockFreeReads);
+    Stats::Memory& memory = context->stats.memory;
+
+    context->affixMemory = std::move(affixMemory);
+
+    if (index) {
+      context->index = index;
+      memory.suggestIndex = index->Size();
+    }
+
+    for (Hunspell* instance : instances) {
+      size_t table, entries, descriptions;
+      instance->dic_memory(table, entries, descriptions);
+      memory.hashTables += table;
+      memory.entries += entries;
+      memory.descriptions += descriptions;
+    }
+
+    // These and the index grew the resident set size too
+    size_t measured = memory.hashTables + memory.entries + memory.descriptions + memory.suggestIndex;
+    memory.instances = after > before + measured ? after - before - measured : 0;
+
+    if (wordStore) {
+      context->wordStore = new WordStore(words, context->sides[0]);
+      memory.wordStore = context->wordStore->Size();
+    }
+
+    return context;
+  }
+
+  /*
+   * Load a dictionary and serialize its words for Load() with the same
+   * affix file, which checks that it's the same. Only the dictionary file
+   * itself is compiled. Can be called from any thread.
+   */
+  static std::string Compile(const std::string& affixFile, const std::string& dictionaryFile) {
+    MappedFile mapped(dictionaryFile);
+    bool compiled = DicFile::is_compiled(mapped.data, mapped.length);
+    Hunspell* instance;
+
+    {
+      std::lock_guard<std::mutex> guard(LoadMutex());
+      instance = NewInstance(affixFile, dictionaryFile, compiled ? &mapped : NULL);
+    }
+
+    std::string result = instance->compile_dic();
+
+    {
+      std::lock_guard<std::mutex> guard(LoadMutex());
       delete instance;
-      instance = NULL;
     }
 
-    uv_rwlock_destroy(&rwLock);
+    return result;
+  }
+
+  /*
+   * Like Load() but reuses a context from the process-wide registry if the
+   * same files (by path and modification time) were already loaded with the
+   * same concurrency, cache size and mode, by any instance on any thread. Shared
+   * contexts must not be written to; see Unshare().
+   */
+  static HunspellContext* LoadShared(
+    uv_loop_t* loop,
+    const std::string& affixFile,
+    const std::string& dictionaryFile,
+    uint32_t concurrency,
+    size_t cacheSize,
+    bool lockFreeReads,
+    bool suggestIndex,
+    bool wordStore) {
+    std::string key = std::to_string(concurrency) + ':' + std::to_string(cacheSize);
+
+    if (lockFreeReads) {
+      key += ":lock-free";
+    }
+
+    if (suggestIndex) {
+      key += ":indexed";
+    }
+
+    if (wordStore) {
+      key += ":word-store";
+    }
+
+    if (!RegistryKey(loop, affixFile, dictionaryFile, key)) {
+      return Load(affixFile, dictionaryFile, concurrency, cacheSize, lockFreeReads, suggestIndex, wordStore);
+    }
+
+    {
+      std::lock_guard<std::mutex> guard(RegistryMutex());
+      auto it = Registry().find(key);
+
+      if (it != Registry().end() && it->second->TryRef()) {
+        it->second->owners++;
+        return it->second;
+      }
+    }
+
+    // Load outside of the lock, so that other dictionaries can be loaded in
+    // the meantime. If another thread loaded the same one, discard ours.
+    HunspellContext* context = Load(affixFile, dictionaryFile, concurrency, cacheSize, lockFreeReads, suggestIndex, wordStore);
+    HunspellContext* existing = NULL;
+
+    {
+      std::lock_guard<std::mutex> guard(RegistryMutex());
+      auto it = Registry().find(key);
+
+      if (it != Registry().end() && it->second->TryRef()) {
+        existing = it->second;
+        existing->owners++;
+      } else {
+        context->key = key;
+        Registry()[key] = context;
+      }
+    }
+
+    if (existing) {
+      delete context;
+      return existing;
+    }
+
+    return context;
+  }
+
+  // Add a dictionary file to an instance, as a write
+  static void AddDictionary(Hunspell* instance, const std::string& dictionaryFile) {
+    std::lock_guard<std::mutex> guard(LoadMutex());
+    instance->add_dic(dictionaryFile.c_str());
+  }
+
+  // Called by every asynchronous call, so only takes the registry lock to
+  // remove the context when the last reference is released. Owners (see
+  // Release()) hold a reference too.
+  void Ref() {
+    refs.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void Unref() {
+    if (refs.fetch_sub(1, std::memory_order_acq_rel) > 1) {
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> guard(RegistryMutex());
+
+      // The registry never revives a context without references (see
+      // TryRef()), but may already have replaced it with a new load
+      if (!key.empty()) {
+        auto it = Registry().find(key);
+
+        if (it != Registry().end() && it->second == this) {
+          Registry().erase(it);
+        }
+      }
+    }
+
+    delete this;
+  }
+
+  // Release the reference of an owner: a Hunspell object, or an overlay
+  void Release() {
+    owners--;
+    Unref();
+  }
+
+  /*
+   * Prepare for a write, on behalf of an owner. If other owners share this
+   * context, the caller gets an overlay, to which the caller's ownership of
+   * this context is transferred. An overlay has its own Hunspell instances
+   * that look words up in this context's instances, which are not copied. A
+   * word is only copied into the overlay when it's added or removed (see
+   * patches/003-shared-dictionaries.patch), and the instances are only
+   * created, which means parsing the affix file, on the overlay's first
+   * read or write. If nobody else owns this context, the caller gets it to
+   * itself, and it's no longer shared with new loads.
+   */
+  HunspellContext* Unshare() {
+    HunspellContext* overlay;
+
+    {
+      std::lock_guard<std::mutex> guard(RegistryMutex());
+
+      // Only contexts in the registry can have more than one owner
+      if (key.empty()) {
+        return this;
+      } else if (owners.load() == 1) {
+        Registry().erase(key);
+        key.clear();
+        return this;
+      }
+
+      overlay = new HunspellContext(this);
+    }
+
+    Release();
+    return overlay;
+  }
+
+  /*
+   * Take a read lock and return an instance to read from. If there is more
+   * than one instance, the returned instance is for exclusive use and this
+   * waits until one is available. Must be followed by release().
+   *
+   * With lock-free reads, this never waits for a write: it reads from
+   * whichever copy of the instances was last published.
+   *
+   * Counts as a call of the operation, unless counted is false, for callers
+   * that count their own calls, like batches counting words.
+   */
+  Hunspell* acquire(Stats::Operation operation, bool counted = true) {
+    Stats::Counters& counters = stats.Of(operation);
+    uint64_t start = uv_hrtime();
+    int side = 0;
+
+    if (counted) {
+      counters.calls.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Prepare();
+
+    if (lockFreeReads) {
+      side = enter();
+    } else {
+      uv_rwlock_rdlock(&rwLock);
+    }
+
+    if (concurrency == 1) {
+      counters.lockWait.Record(uv_hrtime() - start);
+      return sides[side][0];
+    }
+
+    uv_mutex_lock(&poolMutex);
+
+    while (available[side].empty()) {
+      uv_cond_wait(&poolCond, &poolMutex);
+    }
+
+    Hunspell* result = available[side].back();
+    available[side].pop_back();
+
+    uv_mutex_unlock(&poolMutex);
+
+    counters.lockWait.Record(uv_hrtime() - start);
+    return result;
+  }
+
+  void release(Hunspell* reader) {
+    int side = sideOf(reader);
+
+    if (concurrency > 1) {
+      uv_mutex_lock(&poolMutex);
+      available[side].push_back(reader);
+      uv_cond_broadcast(&poolCond);
+      uv_mutex_unlock(&poolMutex);
+    }
+
+    if (lockFreeReads) {
+      leave(side);
+    } else {
+      uv_rwlock_rdunlock(&rwLock);
+    }
+  }
+
+  /*
+   * Apply a write to every instance, then clear the cache. The WordStore is
+   * no longer used after the first write. Normally this takes
+   * the write lock, so it waits for reads in progress and holds up new ones.
+   *
+   * With lock-free reads, the write is applied to the copy that isn't being
+   * read from, which is then published. Once reads of the other copy have
+   * finished, the write is applied to it as well, so that both stay the same.
+   * Writes still wait for each other.
+   */
+  template<typename Apply>
+  void write(Stats::Operation operation, Apply apply) {
+    Stats::Counters& counters = stats.Of(operation);
+    uint64_t start = uv_hrtime();
+
+    counters.calls.fetch_add(1, std::memory_order_relaxed);
+    Prepare();
+
+    if (!lockFreeReads) {
+      uv_rwlock_wrlock(&rwLock);
+      counters.lockWait.Record(uv_hrtime() - start);
+      written = true;
+
+      for (Hunspell* instance : sides[0]) {
+        apply(instance);
+      }
+
+      if (cache) {
+        cache->clear();
+      }
+
+      uv_rwlock_wrunlock(&rwLock);
+      return;
+    }
+
+    std::lock_guard<std::mutex> guard(writeMutex);
+    counters.lockWait.Record(uv_hrtime() - start);
+
+    int previous = active;
+    int next = 1 - previous;
+
+    for (Hunspell* instance : sides[next]) {
+      apply(instance);
+    }
+
+    // Before publishing, so that readers of the written copy don't use the
+    // word store or results cached from the previous copy
+    written = true;
+
+    if (cache) {
+      cache->clear();
+    }
+
+    active = next;
+    drain(previous);
+
+    // Readers of the previous copy may have cached stale results until
+    // they were drained
+    if (cache) {
+      cache->clear();
+    }
+
+    for (Hunspell* instance : sides[previous]) {
+      apply(instance);
+    }
+  }
+
+  /*
+   * Read operations that use the cache if enabled. The reader must have been
+   * acquired, so that writes can't happen until results have been cached.
+   */
+  bool spell(Hunspell* reader, const std::string& word) {
+    CachedResult result;
+
+    if (wordStore && !written.load(std::memory_order_acquire) && wordStore->Contains(word)) {
+      return true;
+    }
+
+    if (!cache || !cache->get('s' + word, result)) {
+      result.correct = reader->spell(word);
+      if (cache) cache->set('s' + word, result);
+    }
+
+    return result.correct;
   }
 
-  void lockRead() {
-    uv_rwlock_rdlock(&rwLock);
+  // Hint that word is about to be spelled, such as the next word of a batch
+  void prefetch(const std::string& word) const {
+    if (wordStore) {
+      wordStore->Prefetch(word);
+    }
   }
 
-  void unlockRead() {
-    uv_rwlock_rdunlock(&rwLock);
+  /*
+   * Get suggestions, unless the word is correct, ranked by Hunspell and cut
+   * to limits.maxSuggestions. If the deadline passes or the call is
+   * cancelled, Hunspell stops looking (see patches/005-suggest-interrupt.patch)
+   * and the suggestions found until then are returned, with timedOut set if
+   * given. Those aren't cached.
+   */
+  bool suggest(
+    Hunspell* reader,
+    const std::string& word,
+    std::vector<std::string>& suggestions,
+    const SuggestLimits& limits = SuggestLimits(),
+    bool* timedOut = NULL) {
+    CachedResult result;
+    bool interrupted = false;
+
+    if (limits.indexed && index) {
+      return suggestIndexed(reader, word, suggestions, limits, timedOut);
+    }
+
+    if (!cache || !cache->get('g' + word, result)) {
+      result.correct = reader->spell(word);
+
+      if (!result.correct && limits.expired()) {
+        interrupted = true;
+      } else if (!result.correct) {
+        if (limits.interruptible()) {
+          reader->set_suggest_interrupt(SuggestLimits::Expired, (void*) &limits);
+        }
+
+        result.words = reader->suggest(word);
+
+        if (limits.interruptible()) {
+          interrupted = reader->suggest_interrupted();
+          reader->set_suggest_interrupt(NULL, NULL);
+        }
+      }
+
+      if (cache && !interrupted) cache->set('g' + word, result);
+    }
+
+    if (timedOut) {
+      *timedOut = interrupted;
+    }
+
+    suggestions = std::move(result.words);
+
+    if (QuickSuggester::Full(suggestions, limits)) {
+      suggestions.resize(limits.maxSuggestions);
+    }
+
+    return result.correct;
   }
 
-  void lockWrite() {
-    uv_rwlock_wrlock(&rwLock);
+  /*
+   * Like suggest(), but with the words one edit away followed by those in the
+   * index instead of Hunspell's suggestions, and at most 15 words unless told
+   * otherwise.
+   */
+  bool suggestIndexed(
+    Hunspell* reader,
+    const std::string& word,
+    std::vector<std::string>& suggestions,
+    const SuggestLimits& limits,
+    bool* timedOut = NULL) {
+    SuggestLimits bounded = limits;
+    CachedResult result;
+
+    if (timedOut) {
+      *timedOut = false;
+    }
+
+    if (bounded.maxSuggestions == 0) {
+      bounded.maxSuggestions = SuggestIndex::MAX_SUGGESTIONS;
+    }
+
+    std::string key = 'i' + std::to_string(bounded.maxSuggestions) + '\0' + word;
+
+    if (!cache || !cache->get(key, result)) {
+      result.correct = reader->spell(word);
+
+      if (!result.correct &&
+          (!quickSuggester.Suggest(reader, word, bounded, result.words) ||
+           !index->Suggest(reader, word, bounded, result.words))) {
+        suggestions = std::move(result.words);
+
+        if (timedOut) {
+          *timedOut = true;
+        }
+
+        return false;
+      }
+
+      if (cache) cache->set(key, result);
+    }
+
+    suggestions = std::move(result.words);
+    return result.correct;
   }
 
-  void unlockWrite() {
-    uv_rwlock_wrunlock(&rwLock);
+  std::vector<std::string> stem(Hunspell* reader, const std::string& word) {
+    CachedResult result;
+
+    if (!cache || !cache->get('t' + word, result)) {
+      result.words = reader->stem(word);
+      if (cache) cache->set('t' + word, result);
+    }
+
+    return result.words;
+  }
+
+  std::vector<std::string> analyze(Hunspell* reader, const std::string& word) {
+    CachedResult result;
+
+    if (!cache || !cache->get('a' + word, result)) {
+      result.words = reader->analyze(word);
+      if (cache) cache->set('a' + word, result);
+    }
+
+    return result.words;
   }
 
 private:
+  HunspellContext(
+    const std::string& affixFile,
+    const std::string& dictionaryFile,
+    std::vector<Hunspell*> instances,
+    size_t cacheSize,
+    bool lockFreeReads)
+  : wordCharacters(instances[0]->get_wordchars_cpp()),
+    concurrency(lockFreeReads ? instances.size() / 2 : instances.size()),
+    lockFreeReads(lockFreeReads),
+    affixFile(affixFile),
+    dictionaryFile(dictionaryFile),
+    quickSuggester(affixFile) {
+    for (size_t i = 0; i < instances.size(); i++) {
+      sides[i / concurrency].push_back(instances[i]);
+    }
+
+    available[0] = sides[0];
+    available[1] = sides[1];
+
+    if (cacheSize > 0) {
+      cache = new Cache<CachedResult>(cacheSize);
+    }
+
+    uv_rwlock_init(&rwLock);
+    uv_mutex_init(&poolMutex);
+    uv_cond_init(&poolCond);
+  };
+
+  // An overlay of base (see Unshare()), which must be called with
+  // RegistryMutex() held. Its instances are created by Prepare().
+  HunspellContext(HunspellContext* base)
+  : wordCharacters(base->wordCharacters),
+    concurrency(base->concurrency),
+    lockFreeReads(base->lockFreeReads),
+    affixFile(base->affixFile),
+    dictionaryFile(base->dictionaryFile),
+    affixMemory(base->affixMemory),
+    quickSuggester(base->quickSuggester),
+    index(base->index),
+    base(base) {
+    if (base->cache) {
+      cache = new Cache<CachedResult>(base->cache->capacity);
+    }
+
+    // There's no WordStore to keep in sync with
+    written = true;
+
+    base->owners++;
+    base->Ref();
+
+    uv_rwlock_init(&rwLock);
+    uv_mutex_init(&poolMutex);
+    uv_cond_init(&poolCond);
+  }
+
+  ~HunspellContext() {
+    {
+      std::lock_guard<std::mutex> guard(LoadMutex());
+
+      for (std::vector<Hunspell*>& instances : sides) {
+        for (Hunspell* instance : instances) {
+          delete instance;
+        }
+
+        instances.clear();
+      }
+    }
+
+    delete cache;
+    cache = NULL;
+
+    // The index of an overlay belongs to its base
+    if (!base) {
+      delete index;
+    }
+
+    index = NULL;
+
+    delete wordStore;
+    wordStore = NULL;
+
+    uv_cond_destroy(&poolCond);
+    uv_mutex_destroy(&poolMutex);
+    uv_rwlock_destroy(&rwLock);
+
+    // After the instances, which look words up in those of the base
+    if (base) {
+      base->Release();
+    }
+  }
+
   /*
    * The Hunspell instance is not thread safe, so we use a mutex
-   * to manage asynchronous usage.
+   * to manage asynchronous usage, unless reads are lock-free.
    */
   uv_rwlock_t rwLock;
+
+  /*
+   * The instances, and the copy of them used for lock-free reads, which is
+   * otherwise empty. Writes must be applied to each of them.
+   */
+  std::vector<Hunspell*> sides[2];
+
+  /*
+   * Hunspell keeps scratch state in its affix manager during reads, so when
+   * there are multiple instances, each reader gets one to itself.
+   */
+  std::vector<Hunspell*> available[2];
+  uv_mutex_t poolMutex;
+  uv_cond_t poolCond;
+
+  // Whether any write happened, after which the WordStore isn't used
+  std::atomic<bool> written{false};
+
+  /*
+   * For lock-free reads: the side readers should use, how many are reading
+   * from each, and a way for writers to wait for one side to be unused.
+   */
+  std::atomic<int> active{0};
+  std::atomic<size_t> readers[2] = {{0}, {0}};
+  std::atomic<bool> draining{false};
+  std::mutex writeMutex;
+  std::mutex drainMutex;
+  std::condition_variable drained;
+
+  int enter() {
+    while (true) {
+      int side = active;
+      readers[side]++;
+
+      // A writer may have switched sides in the meantime, and already be
+      // waiting for this one to be unused
+      if (active == side) {
+        return side;
+      }
+
+      leave(side);
+    }
+  }
+
+  void leave(int side) {
+    if (--readers[side] == 0 && draining) {
+      std::lock_guard<std::mutex> guard(drainMutex);
+      drained.notify_all();
+    }
+  }
+
+  void drain(int side) {
+    std::unique_lock<std::mutex> lock(drainMutex);
+
+    draining = true;
+    drained.wait(lock, [&]() {
+      return readers[side] == 0;
+    });
+    draining = false;
+  }
+
+  // For overlays, whose instances are created on first use
+  std::once_flag prepared;
+
+  /*
+   * Create the instances of an overlay, on the thread of its first read or
+   * write, so that the affix file isn't parsed on the main thread unless the
+   * call itself is synchronous. Each instance starts with an empty
+   * dictionary and shares that of the base's first instance. Does nothing
+   * for contexts that aren't overlays.
+   */
+  void Prepare() {
+    if (!base) {
+      return;
+    }
+
+    std::call_once(prepared, [&]() {
+      uint32_t count = lockFreeReads ? concurrency * 2 : concurrency;
+      Hunspell* shared = base->sides[0][0];
+      size_t before = 0;
+      size_t after = 0;
+
+      uv_resident_set_memory(&before);
+
+      for (uint32_t i = 0; i < count; i++) {
+        std::lock_guard<std::mutex> guard(LoadMutex());
+
+        Hunspell* instance = new Hunspell(affixFile.c_str(), EmptyDictionary().path.c_str(), NULL);
+        instance->share_dic(*shared);
+        sides[i / concurrency].push_back(instance);
+      }
+
+      uv_resident_set_memory(&after);
+
+      available[0] = sides[0];
+      available[1] = sides[1];
+      stats.memory.instances = after > before ? after - before : 0;
+    });
+  }
+
+  // A dictionary file without words, for the instances of overlays.
+  // Deliberately leaked, like the registry.
+  // Load an instance from a dictionary file, or from its compiled words if
+  // given. These are only valid with the affix file they were compiled with,
+  // without which the instance has no words, like with a missing file.
+  static Hunspell* NewInstance(const std::string& affixFile, const std::string& dictionaryFile, const MappedFile* compiled) {
+    if (!compiled) {
+      return new Hunspell(affixFile.c_str(), dictionaryFile.c_str(), NULL);
+    }
+
+    Hunspell* instance = new Hunspell(affixFile.c_str(), EmptyDictionary().path.c_str(), NULL);
+    instance->load_compiled_dic(compiled->data, compiled->length);
+    return instance;
+  }
+
+  static const MemoryFile& EmptyDictionary() {
+    static auto* file = new MemoryFile("1\n", 2, false);
+    return *file;
+  }
+
+  int sideOf(Hunspell* reader) {
+    return std::find(sides[1].begin(), sides[1].end(), reader) != sides[1].end() ? 1 : 0;
+  }
+
+  // The key is guarded by RegistryMutex(), and empty if not in the registry
+  std::atomic<size_t> refs{1};
+  std::string key;
+
+  /*
+   * Number of Hunspell objects and overlays using this context, which unlike
+   * refs doesn't count calls in progress. Only incremented with
+   * RegistryMutex() held, so that Unshare() can rely on it.
+   */
+  std::atomic<size_t> owners{1};
+
+  /*
+   * Take a reference for the registry, unless the last one was already
+   * released, in which case this context is about to be deleted. Must be
+   * called with RegistryMutex() held.
+   */
+  bool TryRef() {
+    size_t count = refs.load(std::memory_order_relaxed);
+
+    while (count > 0 && !refs.compare_exchange_weak(count, count + 1, std::memory_order_relaxed)) {
+    }
+
+    return count > 0;
+  }
+
+  // Deliberately leaked, to stay valid while other threads exit
+  static std::map<std::string, HunspellContext*>& Registry() {
+    static auto* registry = new std::map<std::string, HunspellContext*>();
+    return *registry;
+  }
+
+  static std::mutex& RegistryMutex() {
+    static auto* mutex = new std::mutex();
+    return *mutex;
+  }
+
+  /*
+   * Held while creating or destroying Hunspell objects, or adding dictionaries
+   * to them, on any thread. Hunspell 1.7 counts the users of its global
+   * Unicode table (initialize_utf_tbl() and free_utf_tbl() in csutil.cxx)
+   * without synchronization, so loads that overlap could free it while it's
+   * still in use. Reads don't touch the count.
+   */
+  static std::mutex& LoadMutex() {
+    static auto* mutex = new std::mutex();
+    return *mutex;
+  }
+
+  // Returns false if a file can't be stat-ed, in which case it's not shared
+  static bool RegistryKey(
+    uv_loop_t* loop,
+    const std::string& affixFile,
+    const std::string& dictionaryFile,
+    std::string& key) {
+    for (const std::string* file : { &affixFile, &dictionaryFile }) {
+      uv_fs_t req;
+      int result = uv_fs_stat(loop, &req, file->c_str(), NULL);
+
+      if (result == 0) {
+        key += '\0';
+        key += *file;
+        key += '\0';
+        key += std::to_string(req.statbuf.st_mtim.tv_sec);
+        key += '.';
+        key += std::to_string(req.statbuf.st_mtim.tv_nsec);
+      }
+
+      uv_fs_req_cleanup(&req);
+
+      if (result != 0) {
+        return false;
+      }
+    }
+
+    return true;
+  }
 };
 
 #endif
@@ -0,0 +1,74 @@
+#ifndef LoadOptions_H
+#define LoadOptions_H
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <uv.h>
+#include "HunspellContext.h"
+#include "MemoryFile.h"
+
+/*
+ * What to load, as given to the constructor or Hunspell.load().
+ */
+struct LoadOptions {
+  FileArgument affix;
+  FileArgument dictionary;
+
+  // Number of Hunspell instances to load
+  uint32_t concurrency = 1;
+
+  // Whether to share the loaded dictionary with other instances
+  bool shared = false;
+
+  // Maximum number of results to cache, or 0 to disable caching
+  size_t cacheSize = 0;
+
+  // Whether reads can go on while a write is in progress
+  bool lockFreeReads = false;
+
+  // Whether to build a SuggestIndex for suggest(word, { engine: 'indexed' })
+  bool suggestIndex = false;
+
+  // Whether to build a WordStore to answer spell() for dictionary words
+  bool wordStore = false;
+
+  /*
+   * Can be called from any thread. Files given as buffers are read from
+   * memory. The dictionary file is read in place, while the affix file is
+   * copied, because Hunspell reads it again when adding dictionaries.
+   */
+  HunspellContext* Load(uv_loop_t* loop) const {
+    // Dictionaries loaded from buffers are identified by path, so can't be shared
+    if (shared && !affix.InMemory() && !dictionary.InMemory()) {
+      return HunspellContext::LoadShared(
+        loop,
+        affix.path,
+        dictionary.path,
+        concurrency,
+        cacheSize,
+        lockFreeReads,
+        suggestIndex,
+        wordStore
+      );
+    }
+
+    std::unique_ptr<MemoryFile> affixMemory;
+    std::unique_ptr<MemoryFile> dictionaryMemory;
+    std::string affixFile = affix.Open(affixMemory, true);
+    std::string dictionaryFile = dictionary.Open(dictionaryMemory, false);
+
+    return HunspellContext::Load(
+      affixFile,
+      dictionaryFile,
+      concurrency,
+      cacheSize,
+      lockFreeReads,
+      suggestIndex,
+      wordStore,
+      std::move(affixMemory)
+    );
+  }
+};
+
+#endif
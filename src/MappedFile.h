@@ -0,0 +1,100 @@
+#ifndef MappedFile_H
+#define MappedFile_H
+
+#include <memfile.hxx>
+#include <string>
+#include <uv.h>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+/*
+ * The contents of a file, mapped read-only into memory rather than read
+ * through a stream, or those of a memory file (see MemoryFile) as they are.
+ * Empty if the file can't be opened or mapped. Can be used on any thread.
+ */
+class MappedFile {
+public:
+  const char* data = NULL;
+  size_t length = 0;
+
+  MappedFile(const std::string& path) {
+    if (get_memory_file(path.c_str(), &data, &length)) {
+      return;
+    }
+
+    uv_fs_t req;
+    uv_file file = uv_fs_open(NULL, &req, path.c_str(), UV_FS_O_RDONLY, 0, NULL);
+    uv_fs_req_cleanup(&req);
+
+    if (file < 0) {
+      return;
+    }
+
+    if (uv_fs_fstat(NULL, &req, file, NULL) == 0 && req.statbuf.st_size > 0) {
+      size_t size = (size_t) req.statbuf.st_size;
+      Map(file, size);
+    }
+
+    uv_fs_req_cleanup(&req);
+    uv_fs_close(NULL, &req, file, NULL);
+    uv_fs_req_cleanup(&req);
+  }
+
+  ~MappedFile() {
+    if (!mapped) {
+      return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+    CloseHandle(mapping);
+#else
+    munmap((void*) data, length);
+#endif
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+private:
+  bool mapped = false;
+
+#ifdef _WIN32
+  HANDLE mapping = NULL;
+
+  void Map(uv_file file, size_t size) {
+    mapping = CreateFileMappingW((HANDLE) uv_get_osfhandle(file), NULL, PAGE_READONLY, 0, 0, NULL);
+
+    if (!mapping) {
+      return;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+
+    if (!view) {
+      CloseHandle(mapping);
+      return;
+    }
+
+    data = (const char*) view;
+    length = size;
+    mapped = true;
+  }
+#else
+  void Map(uv_file file, size_t size) {
+    void* view = mmap(NULL, size, PROT_READ, MAP_PRIVATE, file, 0);
+
+    if (view == MAP_FAILED) {
+      return;
+    }
+
+    data = (const char*) view;
+    length = size;
+    mapped = true;
+  }
+#endif
+};
+
+#endif
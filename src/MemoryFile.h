@@ -0,0 +1,81 @@
+#ifndef MemoryFile_H
+#define MemoryFile_H
+
+#include <napi.h>
+#include <memfile.hxx>
+#include <memory>
+#include <string>
+
+/*
+ * Bytes that Hunspell can open by path, through the FileMgr of
+ * patches/002-memory-files.patch, which reads them from memory instead of the
+ * file system. Unless copied, the bytes must stay valid and unchanged for as
+ * long as this object exists.
+ */
+class MemoryFile {
+public:
+  std::string path;
+
+  MemoryFile(const char* data, size_t length, bool copy) {
+    if (copy) {
+      bytes.assign(data, length);
+      data = bytes.data();
+    }
+
+    path = add_memory_file(data, length);
+  }
+
+  ~MemoryFile() {
+    remove_memory_file(path);
+  }
+
+  MemoryFile(const MemoryFile&) = delete;
+  MemoryFile& operator=(const MemoryFile&) = delete;
+
+private:
+  std::string bytes;
+};
+
+/*
+ * A file given to a method: a path, or a buffer with the contents of the
+ * file, which is referenced so that it isn't garbage collected before this is
+ * destroyed (on the main thread). The buffer is read in place, on whichever
+ * thread does the work, so it must not be modified until then.
+ */
+struct FileArgument {
+  std::string path;
+  const char* data = NULL;
+  size_t length = 0;
+  Napi::Reference<Napi::Uint8Array> buffer;
+
+  // The value must be a string or a Uint8Array
+  FileArgument(Napi::Value value) {
+    if (value.IsString()) {
+      path = value.As<Napi::String>().Utf8Value();
+    } else {
+      Napi::Uint8Array array = value.As<Napi::Uint8Array>();
+      data = (const char*) array.Data();
+      length = array.ByteLength();
+      buffer = Napi::Persistent(array);
+    }
+  }
+
+  FileArgument() {}
+
+  bool InMemory() const {
+    return data != NULL;
+  }
+
+  // Get the path to open, which for a buffer is that of a memory file that
+  // must outlive its use. Can be called from any thread.
+  std::string Open(std::unique_ptr<MemoryFile>& memory, bool copy) const {
+    if (!InMemory()) {
+      return path;
+    }
+
+    memory.reset(new MemoryFile(data, length, copy));
+    return memory->path;
+  }
+};
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef Packed_H
+#define Packed_H
+
+#include <napi.h>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/*
+ * The results of a single word, packed like those of a batch (see Batch.h)
+ * rather than as an array of strings: { data, offsets }, where string i is
+ * data from offsets[i] to offsets[i + 1]. See unpack() in index.js.
+ */
+static Napi::Object PackStrings(Napi::Env env, const std::vector<std::string>& strings) {
+  size_t bytes = 0;
+
+  for (const std::string& s : strings) {
+    bytes += s.size();
+  }
+
+  Napi::Buffer<char> data = Napi::Buffer<char>::New(env, bytes);
+  Napi::Uint32Array offsets = Napi::Uint32Array::New(env, strings.size() + 1);
+  size_t offset = 0;
+
+  for (size_t i = 0; i < strings.size(); i++) {
+    offsets[i] = (uint32_t) offset;
+    memcpy(data.Data() + offset, strings[i].data(), strings[i].size());
+    offset += strings[i].size();
+  }
+
+  offsets[strings.size()] = (uint32_t) offset;
+
+  Napi::Object object = Napi::Object::New(env);
+  object.Set("data", data);
+  object.Set("offsets", offsets);
+
+  return object;
+}
+
+#endif
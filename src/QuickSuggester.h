@@ -0,0 +1,167 @@
+#ifndef QuickSuggester_H
+#define QuickSuggester_H
+
+#include <hunspell.hxx>
+#include <filemgr.hxx>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <uv.h>
+
+/*
+ * Bounds on the work done by suggest().
+ */
+struct SuggestLimits {
+  // Return at most this many suggestions, or 0 for no limit
+  size_t maxSuggestions = 0;
+
+  // uv_hrtime() after which to stop looking, or 0 for no deadline
+  uint64_t deadline = 0;
+
+  // Set to stop looking, for example when an AbortSignal aborts
+  const std::atomic<bool>* cancelled = NULL;
+
+  // Whether to look in the context's SuggestIndex instead of asking Hunspell
+  bool indexed = false;
+
+  bool expired() const {
+    return (cancelled && *cancelled) || (deadline > 0 && uv_hrtime() >= deadline);
+  }
+
+  // Whether there are limits that can interrupt a search
+  bool interruptible() const {
+    return cancelled || deadline > 0;
+  }
+
+  // For Hunspell::set_suggest_interrupt(), with the limits as argument
+  static bool Expired(void* limits) {
+    return static_cast<const SuggestLimits*>(limits)->expired();
+  }
+};
+
+/*
+ * Finds the words one edit away from a misspelling: a swap of adjacent
+ * characters, a removed character, or a character replaced or inserted from
+ * the affix file's TRY characters. Unlike Hunspell's own search, which can't
+ * be interrupted, this checks its limits after every candidate. Used with the
+ * SuggestIndex, for the affixed words that the index doesn't have.
+ */
+class QuickSuggester {
+public:
+  // Reads the TRY characters from the affix file, if it has any. Uses
+  // Hunspell's FileMgr, so that files in memory can be read too.
+  QuickSuggester(const std::string& affixFile) {
+    FileMgr file(affixFile.c_str());
+    std::string line;
+
+    while (file.getline(line)) {
+      std::istringstream fields(line);
+      std::string keyword;
+      std::string value;
+
+      if (fields >> keyword >> value && keyword == "TRY") {
+        tryCharacters = Characters(value);
+        break;
+      }
+    }
+  }
+
+  // Returns false if it stopped because the deadline passed or it was
+  // cancelled
+  bool Suggest(
+    Hunspell* reader,
+    const std::string& word,
+    const SuggestLimits& limits,
+    std::vector<std::string>& suggestions) const {
+    std::vector<std::string> characters = Characters(word);
+    size_t length = characters.size();
+    std::string candidate;
+
+    auto check = [&]() {
+      if (std::find(suggestions.begin(), suggestions.end(), candidate) == suggestions.end() &&
+          !candidate.empty() &&
+          reader->spell(candidate)) {
+        suggestions.push_back(candidate);
+      }
+
+      return !Full(suggestions, limits) && !limits.expired();
+    };
+
+    auto join = [&](size_t from, size_t to, std::string& out) {
+      for (size_t i = from; i < to; i++) {
+        out += characters[i];
+      }
+    };
+
+    for (size_t i = 0; i + 1 < length; i++) {
+      candidate.clear();
+      join(0, i, candidate);
+      candidate += characters[i + 1];
+      candidate += characters[i];
+      join(i + 2, length, candidate);
+      if (!check()) return !limits.expired();
+    }
+
+    for (size_t i = 0; i < length; i++) {
+      candidate.clear();
+      join(0, i, candidate);
+      join(i + 1, length, candidate);
+      if (!check()) return !limits.expired();
+    }
+
+    for (size_t i = 0; i < length; i++) {
+      for (const std::string& replacement : tryCharacters) {
+        if (replacement == characters[i]) {
+          continue;
+        }
+
+        candidate.clear();
+        join(0, i, candidate);
+        candidate += replacement;
+        join(i + 1, length, candidate);
+        if (!check()) return !limits.expired();
+      }
+    }
+
+    for (size_t i = 0; i <= length; i++) {
+      for (const std::string& insertion : tryCharacters) {
+        candidate.clear();
+        join(0, i, candidate);
+        candidate += insertion;
+        join(i, length, candidate);
+        if (!check()) return !limits.expired();
+      }
+    }
+
+    return true;
+  }
+
+  static bool Full(const std::vector<std::string>& suggestions, const SuggestLimits& limits) {
+    return limits.maxSuggestions > 0 && suggestions.size() >= limits.maxSuggestions;
+  }
+
+private:
+  std::vector<std::string> tryCharacters;
+
+  // Split UTF-8 into characters. Invalid bytes are kept as they are.
+  static std::vector<std::string> Characters(const std::string& s) {
+    std::vector<std::string> characters;
+    size_t i = 0;
+
+    while (i < s.size()) {
+      unsigned char c = s[i];
+      size_t n = c < 0xC0 ? 1 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+
+      n = std::min(n, s.size() - i);
+      characters.push_back(s.substr(i, n));
+      i += n;
+    }
+
+    return characters;
+  }
+};
+
+#endif
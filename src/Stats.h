@@ -0,0 +1,191 @@
+#ifndef Stats_H
+#define Stats_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER) && defined(_WIN64)
+#include <intrin.h>
+#endif
+
+/*
+ * Durations in nanoseconds, counted in buckets that are 1/8 of a power of two
+ * wide, so that percentiles are within 12.5% of the true value, like an HDR
+ * histogram. Recording is lock-free and can be done from any thread.
+ */
+class Histogram {
+public:
+  static const int SUB_BUCKETS = 8;
+  static const int MAX_EXPONENT = 40;
+  static const int BUCKETS = (MAX_EXPONENT - 2) * SUB_BUCKETS;
+
+  void Record(uint64_t value) {
+    // Longer than about 18 minutes is as good as forever
+    if (value >= (uint64_t) 1 << MAX_EXPONENT) {
+      value = ((uint64_t) 1 << MAX_EXPONENT) - 1;
+    }
+
+    buckets[Index(value)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t previous = max.load(std::memory_order_relaxed);
+
+    while (value > previous && !max.compare_exchange_weak(previous, value, std::memory_order_relaxed)) {
+    }
+  }
+
+  uint64_t Count() const {
+    return count.load(std::memory_order_relaxed);
+  }
+
+  uint64_t Sum() const {
+    return sum.load(std::memory_order_relaxed);
+  }
+
+  uint64_t Max() const {
+    return max.load(std::memory_order_relaxed);
+  }
+
+  uint64_t Bucket(int index) const {
+    return buckets[index].load(std::memory_order_relaxed);
+  }
+
+  // The smallest value that doesn't fit in a bucket
+  static uint64_t UpperBound(int index) {
+    if (index < SUB_BUCKETS) {
+      return index + 1;
+    }
+
+    int shift = index / SUB_BUCKETS - 1;
+    uint64_t lower = (uint64_t) (SUB_BUCKETS + index % SUB_BUCKETS) << shift;
+
+    return lower + ((uint64_t) 1 << shift);
+  }
+
+  // The value below which the given fraction of values are, at most the
+  // maximum. Concurrent updates may make this slightly off.
+  uint64_t Percentile(double fraction) const {
+    uint64_t total = Count();
+    uint64_t seen = 0;
+
+    if (total == 0) {
+      return 0;
+    }
+
+    for (int i = 0; i < BUCKETS; i++) {
+      seen += Bucket(i);
+
+      if (seen > 0 && seen >= fraction * total) {
+        return UpperBound(i) < Max() ? UpperBound(i) : Max();
+      }
+    }
+
+    return Max();
+  }
+
+private:
+  std::atomic<uint64_t> buckets[BUCKETS] = {};
+  std::atomic<uint64_t> count{0};
+  std::atomic<uint64_t> sum{0};
+  std::atomic<uint64_t> max{0};
+
+  static int Index(uint64_t value) {
+    if (value < SUB_BUCKETS) {
+      return (int) value;
+    }
+
+    int exponent = HighestBit(value);
+    int shift = exponent - 3;
+
+    return (exponent - 2) * SUB_BUCKETS + (int) ((value >> shift) & (SUB_BUCKETS - 1));
+  }
+
+  // Position of the highest set bit, for a non-zero value
+  static int HighestBit(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#elif defined(_MSC_VER) && defined(_WIN64)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return (int) index;
+#else
+    int index = 0;
+
+    while (value >>= 1) {
+      index++;
+    }
+
+    return index;
+#endif
+  }
+};
+
+/*
+ * Counters of a context, by operation. Batch and text variants count as the
+ * operation they're made of, so spellBatch() and checkText() count as spell,
+ * addWithAffix(), addMany() and addDictionary() as add.
+ */
+class Stats {
+public:
+  enum Operation { SPELL, SUGGEST, ANALYZE, STEM, GENERATE, ADD, REMOVE, OPERATIONS };
+
+  struct Counters {
+    // Calls that got to read or write the dictionary
+    std::atomic<uint64_t> calls{0};
+
+    // Asynchronous calls queued or running
+    std::atomic<int64_t> inFlight{0};
+
+    // From queueing an asynchronous call to when it starts running
+    Histogram queueWait;
+
+    // Running time of asynchronous calls, including lock wait
+    Histogram execute;
+
+    // Waiting for other calls to let go of the dictionary
+    Histogram lockWait;
+  };
+
+  // Bytes used by each part of a dictionary
+  struct Memory {
+    // Approximate: the growth of the whole process' resident set size while
+    // loading the Hunspell instances, which includes whatever other threads
+    // allocated or freed at the same time, less the structures below
+    size_t instances = 0;
+
+    // Exact sizes of the instances' arenas and hash tables, summed over the
+    // instances (see patches/007-dictionary-arena.patch)
+    size_t hashTables = 0;
+    size_t entries = 0;
+    size_t descriptions = 0;
+
+    // Exact sizes of the structures built next to them, if enabled
+    size_t suggestIndex = 0;
+    size_t wordStore = 0;
+
+    size_t Total() const {
+      return instances + hashTables + entries + descriptions + suggestIndex + wordStore;
+    }
+  };
+
+  Memory memory;
+
+  Counters& Of(Operation operation) {
+    return counters[operation];
+  }
+
+  static const char* Name(Operation operation) {
+    static const char* names[OPERATIONS] = {
+      "spell", "suggest", "analyze", "stem", "generate", "add", "remove"
+    };
+
+    return names[operation];
+  }
+
+private:
+  Counters counters[OPERATIONS];
+};
+
+#endif
@@ -0,0 +1,293 @@
+#ifndef SuggestIndex_H
+#define SuggestIndex_H
+
+#include <hunspell.hxx>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+#include "QuickSuggester.h"
+
+/*
+ * Finds the words of a dictionary file within two edits (insertions,
+ * deletions, substitutions or swaps of adjacent characters) of a misspelling,
+ * without scanning the whole dictionary like Hunspell's n-gram search does.
+ *
+ * Works like SymSpell: every word is stored under each string that its
+ * prefix becomes by deleting up to two characters. Two words within two edits
+ * of each other then share such a string, so a lookup only needs to delete
+ * characters from the misspelling's prefix and gather the words stored under
+ * the results, which are then checked with an exact edit distance.
+ *
+ * Only words of the dictionary file itself are indexed, not their affixed
+ * forms nor words added later, so this is combined with the words one edit
+ * away that QuickSuggester finds.
+ */
+class SuggestIndex {
+public:
+  static const size_t MAX_DISTANCE = 2;
+
+  // Longer prefixes make lookups more precise but the index larger
+  static const size_t PREFIX_LENGTH = 7;
+
+  // Like Hunspell's MAXSUGGESTION
+  static const size_t MAX_SUGGESTIONS = 15;
+
+  // Indexes the words of a .dic file, as read by DictionaryFile
+  SuggestIndex(const std::vector<std::string>& words) {
+    for (uint32_t id = 0; id < words.size(); id++) {
+      offsets.push_back((uint32_t) bytes.size());
+      bytes += words[id];
+
+      Deletes(Prefix(CodePoints(words[id])), [&](const std::u32string& deleted) {
+        entries.push_back({ Hash(deleted), id });
+        return true;
+      });
+    }
+
+    offsets.push_back((uint32_t) bytes.size());
+    bytes.shrink_to_fit();
+    offsets.shrink_to_fit();
+
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+    entries.shrink_to_fit();
+  }
+
+  /*
+   * Add correct words within two edits of word to suggestions, nearest first,
+   * until there are limits.maxSuggestions of them. Returns false if it stopped
+   * because the deadline passed or it was cancelled.
+   */
+  bool Suggest(
+    Hunspell* reader,
+    const std::string& word,
+    const SuggestLimits& limits,
+    std::vector<std::string>& suggestions) const {
+    std::u32string input = CodePoints(word);
+    std::u32string other;
+    std::vector<size_t> rows;
+    std::unordered_set<uint32_t> seen;
+    std::vector<Candidate> candidates;
+
+    // Common prefixes, like those of compounds, can have thousands of
+    // candidates, so the limits are checked for each of them
+    bool finished = Deletes(Prefix(input), [&](const std::u32string& deleted) {
+      Entry first = { Hash(deleted), 0 };
+      auto it = std::lower_bound(entries.begin(), entries.end(), first);
+
+      for (; it != entries.end() && it->hash == first.hash; it++) {
+        if (limits.expired()) {
+          return false;
+        } else if (!seen.insert(it->id).second) {
+          continue;
+        }
+
+        CodePoints(Word(it->id), other);
+        size_t lengthDifference = input.size() > other.size()
+          ? input.size() - other.size()
+          : other.size() - input.size();
+
+        if (lengthDifference > MAX_DISTANCE) {
+          continue;
+        }
+
+        size_t distance = Distance(input, other, rows);
+
+        if (distance > 0 && distance <= MAX_DISTANCE) {
+          candidates.push_back({ distance, lengthDifference, it->id });
+        }
+      }
+
+      return true;
+    });
+
+    if (!finished) {
+      return false;
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const Candidate& candidate : candidates) {
+      if (QuickSuggester::Full(suggestions, limits)) {
+        return true;
+      } else if (limits.expired()) {
+        return false;
+      }
+
+      std::string suggestion(Word(candidate.id));
+
+      // The dictionary may have forbidden words, or words that are only
+      // valid with an affix or in compounds
+      if (std::find(suggestions.begin(), suggestions.end(), suggestion) == suggestions.end() &&
+          reader->spell(suggestion)) {
+        suggestions.push_back(suggestion);
+      }
+    }
+
+    return true;
+  }
+
+  size_t Size() const {
+    return bytes.size() + offsets.size() * sizeof(uint32_t) + entries.size() * sizeof(Entry);
+  }
+
+private:
+  struct Entry {
+    uint32_t hash;
+    uint32_t id;
+
+    bool operator<(const Entry& other) const {
+      return hash < other.hash || (hash == other.hash && id < other.id);
+    }
+
+    bool operator==(const Entry& other) const {
+      return hash == other.hash && id == other.id;
+    }
+  };
+
+  struct Candidate {
+    size_t distance;
+    size_t lengthDifference;
+    uint32_t id;
+
+    // Nearest first, then in order of the dictionary
+    bool operator<(const Candidate& other) const {
+      if (distance != other.distance) return distance < other.distance;
+      if (lengthDifference != other.lengthDifference) return lengthDifference < other.lengthDifference;
+      return id < other.id;
+    }
+  };
+
+  // The words, concatenated rather than allocated one by one, and where
+  // each of them starts, followed by the end of the last one
+  std::string bytes;
+  std::vector<uint32_t> offsets;
+
+  // Sorted by hash of the deleted string. Hashes may collide, which only
+  // adds candidates that are then rejected by their distance.
+  std::vector<Entry> entries;
+
+  std::string_view Word(uint32_t id) const {
+    return std::string_view(bytes).substr(offsets[id], offsets[id + 1] - offsets[id]);
+  }
+
+  static std::u32string CodePoints(std::string_view s) {
+    std::u32string result;
+    CodePoints(s, result);
+    return result;
+  }
+
+  // Decode into result, reusing its memory
+  static void CodePoints(std::string_view s, std::u32string& result) {
+    size_t i = 0;
+
+    result.clear();
+
+    while (i < s.size()) {
+      unsigned char c = s[i];
+      size_t n = c < 0xC0 ? 1 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+      char32_t code = n == 1 ? c : c & (0x3F >> (n - 1));
+
+      n = std::min(n, s.size() - i);
+
+      for (size_t j = 1; j < n; j++) {
+        code = (code << 6) | (s[i + j] & 0x3F);
+      }
+
+      result += code;
+      i += n;
+    }
+  }
+
+  static std::u32string Prefix(const std::u32string& s) {
+    return s.substr(0, PREFIX_LENGTH);
+  }
+
+  // Call fn with s and each string made by deleting up to two characters,
+  // until it returns false. Strings may be repeated. Returns false if fn did.
+  template<typename Fn>
+  static bool Deletes(const std::u32string& s, Fn fn) {
+    if (!fn(s)) {
+      return false;
+    }
+
+    for (size_t i = 0; i < s.size(); i++) {
+      std::u32string once = s.substr(0, i) + s.substr(i + 1);
+
+      if (!fn(once)) {
+        return false;
+      }
+
+      for (size_t j = i; j < once.size(); j++) {
+        if (!fn(once.substr(0, j) + once.substr(j + 1))) {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  // FNV-1a
+  static uint32_t Hash(const std::u32string& s) {
+    uint32_t hash = 2166136261u;
+
+    for (char32_t c : s) {
+      hash = (hash ^ (uint32_t) c) * 16777619u;
+    }
+
+    return hash;
+  }
+
+  /*
+   * Optimal string alignment distance, which counts a swap of adjacent
+   * characters as one edit, or MAX_DISTANCE + 1 if it's larger. Only the last
+   * three rows of the matrix are kept, in rows, as a swap looks two back.
+   */
+  static size_t Distance(const std::u32string& a, const std::u32string& b, std::vector<size_t>& rows) {
+    size_t width = b.size() + 1;
+
+    rows.assign(width * 3, 0);
+
+    size_t* before = rows.data();
+    size_t* previous = before + width;
+    size_t* current = previous + width;
+    size_t previousLowest = 0;
+
+    for (size_t j = 0; j < width; j++) {
+      previous[j] = j;
+    }
+
+    for (size_t i = 1; i <= a.size(); i++) {
+      size_t lowest = current[0] = i;
+
+      for (size_t j = 1; j < width; j++) {
+        size_t cost = a[i - 1] == b[j - 1] ? 0 : 1;
+        size_t d = std::min({ previous[j] + 1, current[j - 1] + 1, previous[j - 1] + cost });
+
+        if (i > 1 && j > 1 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1]) {
+          d = std::min(d, before[j - 2] + 1);
+        }
+
+        current[j] = d;
+        lowest = std::min(lowest, d);
+      }
+
+      // Later rows can't go below both of the last two
+      if (lowest > MAX_DISTANCE && previousLowest > MAX_DISTANCE) {
+        return MAX_DISTANCE + 1;
+      }
+
+      previousLowest = lowest;
+      std::swap(before, previous);
+      std::swap(previous, current);
+    }
+
+    return std::min(previous[b.size()], MAX_DISTANCE + 1);
+  }
+};
+
+#endif
@@ -0,0 +1,282 @@
+#ifndef ThreadPool_H
+#define ThreadPool_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * Threads owned by the addon, as an alternative to the libuv threadpool that
+ * is shared with fs, dns and zlib. Each thread has its own queues, which idle
+ * threads steal from. Work comes in lanes: a thread always looks for fast
+ * work (on its own queue, then on others) before slow work, so that cheap
+ * calls like spell() don't wait behind expensive ones like suggest(). With
+ * more than one thread, one is always kept free of slow work, so that fast
+ * work doesn't wait for slow work to finish either.
+ *
+ * There's one pool per process, shared by all worker threads. Its threads are
+ * never joined; they sleep when there's nothing to do.
+ */
+class ThreadPool {
+public:
+  enum Lane { FAST = 0, SLOW = 1, LANES = 2 };
+
+  class Task {
+  public:
+    virtual ~Task() {}
+
+    // Called on a pool thread
+    virtual void Run() = 0;
+  };
+
+  // Deliberately leaked, like the threads
+  static ThreadPool& Shared() {
+    static auto* pool = new ThreadPool();
+    return *pool;
+  }
+
+  size_t Size() {
+    return size;
+  }
+
+  /*
+   * Start or retire threads. Retired threads finish the work on their queues
+   * first. A size of 0 means work should go to the libuv threadpool instead.
+   */
+  void Resize(size_t newSize) {
+    std::lock_guard<std::mutex> guard(mutex);
+
+    while (workers.size() < newSize) {
+      workers.emplace_back(new Queues());
+    }
+
+    size_t oldSize = size;
+    size = newSize;
+
+    for (size_t i = oldSize; i < newSize; i++) {
+      // A retired thread may still be draining its queues, in which case it
+      // picks up again without a new thread being started
+      if (!workers[i]->running) {
+        workers[i]->running = true;
+        std::thread(&ThreadPool::Loop, this, i).detach();
+      }
+    }
+
+    sleeping.notify_all();
+  }
+
+  // Returns false if the pool has no threads
+  bool Submit(Task* task, Lane lane) {
+    Queues* queues;
+
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+
+      if (size == 0) {
+        return false;
+      }
+
+      queues = workers[next++ % size].get();
+      queued[lane]++;
+    }
+
+    {
+      std::lock_guard<std::mutex> guard(queues->mutex);
+      queues->lanes[lane].push_back(task);
+    }
+
+    sleeping.notify_one();
+    return true;
+  }
+
+  // Remove a task that hasn't started. Returns false if it's not queued.
+  bool Cancel(Task* task) {
+    std::vector<Queues*> all = Snapshot();
+
+    for (Queues* queues : all) {
+      int lane = Remove(queues, task);
+
+      if (lane >= 0) {
+        std::lock_guard<std::mutex> guard(mutex);
+        queued[lane]--;
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+private:
+  struct Queues {
+    std::mutex mutex;
+    std::deque<Task*> lanes[LANES];
+
+    // Guarded by ThreadPool::mutex
+    bool running = false;
+  };
+
+  // Guards the fields below. Queues have their own mutex, taken after this
+  // one if both are needed.
+  std::mutex mutex;
+  std::condition_variable sleeping;
+  std::vector<std::unique_ptr<Queues>> workers;
+  std::atomic<size_t> size{0};
+  size_t next = 0;
+  size_t queued[LANES] = { 0, 0 };
+
+  // Threads running slow work, at most SlowLimit()
+  size_t slowRunning = 0;
+
+  ThreadPool() {}
+
+  std::vector<Queues*> Snapshot() {
+    std::lock_guard<std::mutex> guard(mutex);
+    std::vector<Queues*> all;
+
+    for (auto& queues : workers) {
+      all.push_back(queues.get());
+    }
+
+    return all;
+  }
+
+  void Loop(size_t index) {
+    Queues* own;
+
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      own = workers[index].get();
+    }
+
+    while (true) {
+      int lane;
+      Task* task = Take(own, lane);
+
+      if (task) {
+        task->Run();
+
+        if (lane == SLOW) {
+          std::lock_guard<std::mutex> guard(mutex);
+          slowRunning--;
+          sleeping.notify_all();
+        }
+
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(mutex);
+
+      if (index >= size && Empty(own)) {
+        own->running = false;
+        return;
+      }
+
+      // A retired thread with slow work left waits for its turn like the others
+      sleeping.wait(lock, [&]() {
+        return queued[FAST] > 0 ||
+          (queued[SLOW] > 0 && slowRunning < SlowLimit()) ||
+          (index >= size && Empty(own));
+      });
+
+      if (index >= size && Empty(own)) {
+        own->running = false;
+        return;
+      }
+    }
+  }
+
+  // Guarded by mutex. One thread stays free for fast work, unless it's the
+  // only one.
+  size_t SlowLimit() const {
+    return size > 1 ? size - 1 : 1;
+  }
+
+  // Own work before stolen work within a lane, and fast lanes first. Slow
+  // work is only taken while under SlowLimit().
+  Task* Take(Queues* own, int& lane) {
+    std::vector<Queues*> all = Snapshot();
+
+    for (lane = 0; lane < LANES; lane++) {
+      if (lane == SLOW) {
+        std::lock_guard<std::mutex> guard(mutex);
+
+        if (slowRunning >= SlowLimit()) {
+          return NULL;
+        }
+
+        slowRunning++;
+      }
+
+      Task* task = Pop(own, lane, true);
+
+      for (size_t i = 0; !task && i < all.size(); i++) {
+        if (all[i] != own) {
+          task = Pop(all[i], lane, false);
+        }
+      }
+
+      std::lock_guard<std::mutex> guard(mutex);
+
+      if (task) {
+        queued[lane]--;
+        return task;
+      } else if (lane == SLOW) {
+        slowRunning--;
+      }
+    }
+
+    return NULL;
+  }
+
+  // The owner takes the oldest task, thieves the newest, so that they rarely
+  // compete for the same end of a queue
+  static Task* Pop(Queues* queues, int lane, bool owner) {
+    std::lock_guard<std::mutex> guard(queues->mutex);
+    std::deque<Task*>& tasks = queues->lanes[lane];
+
+    if (tasks.empty()) {
+      return NULL;
+    }
+
+    Task* task;
+
+    if (owner) {
+      task = tasks.front();
+      tasks.pop_front();
+    } else {
+      task = tasks.back();
+      tasks.pop_back();
+    }
+
+    return task;
+  }
+
+  // Returns the lane the task was in, or -1 if it wasn't queued
+  static int Remove(Queues* queues, Task* task) {
+    std::lock_guard<std::mutex> guard(queues->mutex);
+
+    for (int lane = 0; lane < LANES; lane++) {
+      std::deque<Task*>& tasks = queues->lanes[lane];
+      auto it = std::find(tasks.begin(), tasks.end(), task);
+
+      if (it != tasks.end()) {
+        tasks.erase(it);
+        return lane;
+      }
+    }
+
+    return -1;
+  }
+
+  static bool Empty(Queues* queues) {
+    std::lock_guard<std::mutex> guard(queues->mutex);
+    return queues->lanes[FAST].empty() && queues->lanes[SLOW].empty();
+  }
+};
+
+#endif
@@ -0,0 +1,167 @@
+#ifndef Tokenizer_H
+#define Tokenizer_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+ * Splits UTF-8 text into words. A word is a run of letters, ASCII digits and
+ * the dictionary's WORDCHARS, with leading and trailing WORDCHARS that are not
+ * letters or digits (like quotes and hyphens) trimmed off.
+ */
+class Tokenizer {
+public:
+  Tokenizer(const std::string& wordCharacters) {
+    const unsigned char* s = (const unsigned char*) wordCharacters.data();
+    size_t length = wordCharacters.size();
+    size_t i = 0;
+
+    while (i < length) {
+      uint32_t codePoint;
+      i += Decode(s + i, length - i, codePoint);
+      this->wordCharacters.push_back(codePoint);
+    }
+
+    std::sort(this->wordCharacters.begin(), this->wordCharacters.end());
+  }
+
+  // Calls fn(offset, length) for every word, in bytes, until it returns false
+  template <typename F>
+  void Tokenize(const char* text, size_t length, F fn) const {
+    const unsigned char* s = (const unsigned char*) text;
+    const size_t none = (size_t) -1;
+    size_t i = 0;
+
+    while (i < length) {
+      uint32_t codePoint;
+      size_t n = Decode(s + i, length - i, codePoint);
+
+      if (!IsWordCharacter(codePoint)) {
+        i += n;
+        continue;
+      }
+
+      size_t first = none;
+      size_t last = 0;
+
+      while (i < length) {
+        n = Decode(s + i, length - i, codePoint);
+
+        if (!IsWordCharacter(codePoint)) {
+          break;
+        }
+
+        if (IsAlphanumeric(codePoint)) {
+          if (first == none) first = i;
+          last = i + n;
+        }
+
+        i += n;
+      }
+
+      if (first != none && !fn(first, last - first)) {
+        return;
+      }
+    }
+  }
+
+private:
+  std::vector<uint32_t> wordCharacters;
+
+  bool IsWordCharacter(uint32_t codePoint) const {
+    return IsAlphanumeric(codePoint) || std::binary_search(
+      wordCharacters.begin(),
+      wordCharacters.end(),
+      codePoint
+    );
+  }
+
+  static bool IsAlphanumeric(uint32_t codePoint) {
+    return (codePoint >= '0' && codePoint <= '9') || IsLetter(codePoint);
+  }
+
+  /*
+   * Approximates the Unicode letter classes without pulling in ICU: ASCII and
+   * Latin-1 letters are matched exactly, and any other code point is treated
+   * as a letter (or combining mark) unless it belongs to a block of
+   * punctuation, symbols, emoji or other non-word characters.
+   */
+  static bool IsLetter(uint32_t c) {
+    if (c < 0x80) {
+      return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    } else if (c < 0x100) {
+      return c == 0xAA || c == 0xB5 || c == 0xBA ||
+        (c >= 0xC0 && c != 0xD7 && c != 0xF7);
+    }
+
+    return !(
+      c == 0x037E || c == 0x0387 || // Greek question mark and ano teleia
+      c == 0x0589 || c == 0x05BE || // Armenian full stop, Hebrew maqaf
+      c == 0x060C || c == 0x061B || c == 0x061F || c == 0x06D4 || // Arabic
+      c == 0x0964 || c == 0x0965 || // Devanagari danda
+      (c >= 0x2000 && c <= 0x2BFF) || // Punctuation, symbols, arrows, shapes
+      (c >= 0x2E00 && c <= 0x2E7F) || // Supplemental punctuation
+      (c >= 0x3000 && c <= 0x303F) || // CJK symbols and punctuation
+      (c >= 0xD800 && c <= 0xF8FF) || // Surrogates and private use
+      (c >= 0xFE10 && c <= 0xFE1F) || // Vertical forms
+      (c >= 0xFE30 && c <= 0xFE6F) || // CJK compatibility and small forms
+      c == 0xFEFF || // Byte order mark
+      (c >= 0xFF00 && c <= 0xFF0F) || // Fullwidth punctuation
+      (c >= 0xFF1A && c <= 0xFF20) ||
+      (c >= 0xFF3B && c <= 0xFF40) ||
+      (c >= 0xFF5B && c <= 0xFF65) ||
+      (c >= 0xFFF0 && c <= 0xFFFF) || // Specials, including U+FFFD
+      (c >= 0x1F000 && c <= 0x1FAFF) || // Emoji and pictographs
+      c >= 0xF0000 // Supplementary private use
+    );
+  }
+
+  // Decode one code point and return the number of bytes it took. Invalid
+  // sequences decode to U+FFFD, one byte at a time.
+  static size_t Decode(const unsigned char* s, size_t length, uint32_t& codePoint) {
+    unsigned char c = s[0];
+    size_t n;
+    uint32_t min;
+
+    if (c < 0x80) {
+      codePoint = c;
+      return 1;
+    } else if ((c & 0xE0) == 0xC0) {
+      n = 2; min = 0x80; codePoint = c & 0x1F;
+    } else if ((c & 0xF0) == 0xE0) {
+      n = 3; min = 0x800; codePoint = c & 0x0F;
+    } else if ((c & 0xF8) == 0xF0) {
+      n = 4; min = 0x10000; codePoint = c & 0x07;
+    } else {
+      codePoint = 0xFFFD;
+      return 1;
+    }
+
+    if (n > length) {
+      codePoint = 0xFFFD;
+      return 1;
+    }
+
+    for (size_t i = 1; i < n; i++) {
+      if ((s[i] & 0xC0) != 0x80) {
+        codePoint = 0xFFFD;
+        return 1;
+      }
+
+      codePoint = (codePoint << 6) | (s[i] & 0x3F);
+    }
+
+    if (codePoint < min || codePoint > 0x10FFFF ||
+        (codePoint >= 0xD800 && codePoint <= 0xDFFF)) {
+      codePoint = 0xFFFD;
+      return 1;
+    }
+
+    return n;
+  }
+};
+
+#endif
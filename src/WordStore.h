@@ -0,0 +1,144 @@
+#ifndef WordStore_H
+#define WordStore_H
+
+#include <hunspell.hxx>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+/*
+ * The words of a dictionary file that Hunspell says are correct, in an
+ * open-addressing hash table, so that spell() can answer for them with one
+ * or two probes into contiguous memory instead of Hunspell's affix stripping
+ * and chained buckets.
+ *
+ * Each slot holds the full hash of its word and where the word is in one
+ * buffer of all words, so that a probe only compares bytes once the hashes
+ * match. Words that aren't found are left to Hunspell, which gives the same
+ * answer as long as the dictionary isn't written to.
+ */
+class WordStore {
+public:
+  /*
+   * Checks the words of a .dic file, as read by DictionaryFile, spread over
+   * the given instances, one thread each. The result doesn't depend on the
+   * number of instances.
+   */
+  WordStore(const std::vector<std::string>& dictionaryWords, const std::vector<Hunspell*>& readers) {
+    std::vector<uint8_t> correct(dictionaryWords.size());
+    std::vector<std::thread> threads;
+
+    auto check = [&](size_t reader) {
+      for (size_t i = reader; i < dictionaryWords.size(); i += readers.size()) {
+        correct[i] = readers[reader]->spell(dictionaryWords[i]) ? 1 : 0;
+      }
+    };
+
+    for (size_t reader = 1; reader < readers.size(); reader++) {
+      threads.emplace_back(check, reader);
+    }
+
+    check(0);
+
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    std::vector<std::string> words;
+
+    for (size_t i = 0; i < dictionaryWords.size(); i++) {
+      if (correct[i]) {
+        words.push_back(dictionaryWords[i]);
+      }
+    }
+
+    // At most half full, so that probe sequences stay short
+    size_t capacity = 16;
+
+    while (capacity < words.size() * 2) {
+      capacity *= 2;
+    }
+
+    slots.resize(capacity);
+    mask = capacity - 1;
+
+    for (const std::string& word : words) {
+      uint32_t hash = Hash(word.data(), word.size());
+      size_t i = hash & mask;
+
+      while (slots[i].length > 0 && !Equals(slots[i], hash, word.data(), word.size())) {
+        i = (i + 1) & mask;
+      }
+
+      if (slots[i].length == 0) {
+        slots[i] = { hash, (uint32_t) bytes.size(), (uint32_t) word.size() };
+        bytes += word;
+      }
+    }
+
+    bytes.shrink_to_fit();
+  }
+
+  bool Contains(const std::string& word) const {
+    uint32_t hash = Hash(word.data(), word.size());
+
+    for (size_t i = hash & mask; slots[i].length > 0; i = (i + 1) & mask) {
+      if (Equals(slots[i], hash, word.data(), word.size())) {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  // Start loading the slot of a word that is about to be looked up, such as
+  // the next word of a batch
+  void Prefetch(const std::string& word) const {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(&slots[Hash(word.data(), word.size()) & mask]);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch((const char*) &slots[Hash(word.data(), word.size()) & mask], _MM_HINT_T0);
+#endif
+  }
+
+  size_t Size() const {
+    return slots.size() * sizeof(Slot) + bytes.size();
+  }
+
+private:
+  // Empty if length is 0, as empty words are never stored
+  struct Slot {
+    uint32_t hash = 0;
+    uint32_t offset = 0;
+    uint32_t length = 0;
+  };
+
+  std::vector<Slot> slots;
+  size_t mask = 0;
+  std::string bytes;
+
+  bool Equals(const Slot& slot, uint32_t hash, const char* data, size_t length) const {
+    return slot.hash == hash &&
+      slot.length == length &&
+      memcmp(bytes.data() + slot.offset, data, length) == 0;
+  }
+
+  // FNV-1a
+  static uint32_t Hash(const char* data, size_t length) {
+    uint32_t hash = 2166136261u;
+
+    for (size_t i = 0; i < length; i++) {
+      hash = (hash ^ (unsigned char) data[i]) * 16777619u;
+    }
+
+    return hash;
+  }
+};
+
+#endif
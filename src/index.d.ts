@@ -1,16 +1,301 @@
+import type { Transform } from 'node:stream'
+
 /**
  * Hunspell dictionary.
  */
 export interface Dictionary {
   /**
-   * Path to the affix file.
+   * Path to the affix file, or its contents, which are copied.
+   */
+  aff: string | Uint8Array
+
+  /**
+   * Path to the dictionary file, or its contents, which are read in place and
+   * must not be modified until loading is done.
+   */
+  dic: string | Uint8Array
+}
+
+/**
+ * Options for the {@link Hunspell} constructor.
+ */
+export interface HunspellOptions {
+  /**
+   * Number of Hunspell instances to load, allowing that many read operations
+   * to run in parallel. Each instance holds a copy of the dictionary in
+   * memory. Defaults to 1.
+   */
+  concurrency?: number
+
+  /**
+   * Share the loaded dictionary with other instances, including those on
+   * other worker threads, that were created with the same files and
+   * `concurrency` and also have `shared` set. Ignored if the dictionary is
+   * given as buffers. The first write (like
+   * {@link Hunspell.add()}) gives an instance its own overlay, which holds
+   * only the words changed by writes. Defaults to false.
+   */
+  shared?: boolean
+
+  /**
+   * Maximum number of results of {@link Hunspell.spell()},
+   * {@link Hunspell.suggest()}, {@link Hunspell.stem()} and
+   * {@link Hunspell.analyze()} (and their variants) to keep in memory, so
+   * that repeated lookups of the same word are answered without asking
+   * Hunspell again. Least recently used results are discarded first, and all
+   * results are discarded on writes. Defaults to 0, which disables caching.
+   */
+  cacheSize?: number
+
+  /**
+   * Keep serving reads while a write (like {@link Hunspell.add()}) is in
+   * progress. Writes are applied to a second copy of the instances, which is
+   * then swapped in, so this doubles the memory used. Defaults to false, in
+   * which case a write waits for reads in progress and holds up new ones.
+   */
+  lockFreeReads?: boolean
+
+  /**
+   * Build an index of the words of the dictionary file, which enables
+   * `engine: 'indexed'` in {@link Hunspell.suggest()}. Defaults to false.
+   */
+  suggestIndex?: boolean
+
+  /**
+   * Store the correct words of the dictionary file in a hash table that
+   * {@link Hunspell.spell()} looks in before asking Hunspell, until the
+   * first write. Defaults to false.
+   */
+  wordStore?: boolean
+}
+
+/**
+ * Counters returned by {@link Hunspell.getCacheStats()}.
+ */
+export interface CacheStats {
+  /** Number of lookups answered from the cache. */
+  hits: number
+  /** Number of lookups that had to ask Hunspell. */
+  misses: number
+  /** Number of results currently cached. */
+  size: number
+  /** Maximum number of results, as given by `cacheSize`. */
+  capacity: number
+}
+
+/**
+ * Durations in milliseconds, recorded with a precision of 12.5%.
+ */
+export interface Histogram {
+  /** Number of recorded durations. */
+  count: number
+  /** Total of recorded durations. */
+  sum: number
+  /** Longest recorded duration. */
+  max: number
+  p50: number
+  p90: number
+  p99: number
+  p999: number
+  /**
+   * Non-empty buckets as pairs of upper bound (exclusive) and number of
+   * durations in that bucket, in ascending order.
+   */
+  buckets: Array<[number, number]>
+}
+
+/**
+ * Counters of one kind of operation, returned by {@link Hunspell.stats()}.
+ */
+export interface OperationStats {
+  /** Number of calls that read or wrote the dictionary. */
+  calls: number
+  /** Number of asynchronous calls that are queued or running. */
+  inFlight: number
+  /** Time asynchronous calls spent queued before running. */
+  queueWait: Histogram
+  /** Time asynchronous calls spent running, including `lockWait`. */
+  execute: Histogram
+  /** Time calls spent waiting for other calls to let go of the dictionary. */
+  lockWait: Histogram
+}
+
+/**
+ * Counters returned by {@link Hunspell.stats()}.
+ */
+export interface Stats {
+  /**
+   * Estimated memory used by the dictionary in bytes, the sum of
+   * `memoryByStructure`. Only approximate, as it includes `instances`.
+   */
+  memory: number
+  memoryByStructure: {
+    /**
+     * The rest of the Hunspell instances, approximated by the growth of the
+     * whole process' resident set size while loading them, less the
+     * structures below, which includes what anything else in the process
+     * allocated meanwhile.
+     */
+    instances: number
+    /** The hash tables of the instances' words. */
+    hashTables: number
+    /** The arenas of the instances' word entries. */
+    entries: number
+    /** The interned morphological descriptions of the instances' words. */
+    descriptions: number
+    /** The index built by the `suggestIndex` option, or 0. */
+    suggestIndex: number
+    /** The table built by the `wordStore` option, or 0. */
+    wordStore: number
+  }
+  operations: {
+    spell: OperationStats
+    suggest: OperationStats
+    analyze: OperationStats
+    stem: OperationStats
+    generate: OperationStats
+    add: OperationStats
+    remove: OperationStats
+  }
+}
+
+/**
+ * Options accepted by all asynchronous methods.
+ */
+export interface AsyncOptions {
+  /**
+   * Signal to abort the operation. Once aborted, the operation is dropped if
+   * it hasn't started yet, and the promise is rejected with the signal's
+   * reason. Writes that already started complete and resolve normally.
+   */
+  signal?: AbortSignal
+}
+
+/**
+ * Options for {@link Hunspell.createCheckStream()}.
+ */
+export interface CheckStreamOptions extends CheckTextOptions {
+  /**
+   * Number of bytes to check at once. Defaults to 65536.
+   */
+  batchSize?: number
+
+  /**
+   * Maximum number of batches to check at the same time, before the stream
+   * stops accepting input. Defaults to 4.
+   */
+  maxInFlight?: number
+}
+
+/**
+ * Misspelled word emitted by {@link Hunspell.createCheckStream()}.
+ */
+export interface Misspelling {
+  /** The word. */
+  word: string
+  /** Position of the word in bytes, from the start of the input. */
+  offset: number
+  /** Length of the word in bytes. */
+  length: number
+}
+
+/**
+ * Options for {@link Hunspell.suggest()}.
+ */
+export interface SuggestOptions {
+  /**
+   * Maximum number of suggestions to return, the first of Hunspell's ranked
+   * list.
+   */
+  maxSuggestions?: number
+
+  /**
+   * Time in milliseconds, from the call, after which to stop looking for
+   * suggestions and return those found so far, marked with
+   * {@link Suggestions.timedOut}.
+   */
+  timeoutMs?: number
+
+  /**
+   * How to look for suggestions: with Hunspell's full search (the default),
+   * or in the index built by the `suggestIndex` load option, which is faster
+   * but only finds dictionary words at most two edits away.
+   */
+  engine?: 'hunspell' | 'indexed'
+}
+
+/**
+ * Options for {@link Hunspell.stemBatch()} and
+ * {@link Hunspell.analyzeBatch()}.
+ */
+export interface BatchOptions {
+  /**
+   * Number of threads to spread the words over, the size of the threadpool
+   * by default. Lowered to that size, and to the `concurrency` of the
+   * instance if it's greater than 1.
+   */
+  parallelism?: number
+}
+
+/**
+ * Options for {@link Hunspell.suggestBatch()}.
+ */
+export interface SuggestBatchOptions extends SuggestOptions, BatchOptions {}
+
+/**
+ * Words packed into one buffer of UTF-8: word `i` is `data` from
+ * `offsets[i]` to `offsets[i + 1]`, so there is one more offset than words.
+ */
+export interface PackedWords {
+  data: Uint8Array
+  offsets: Uint32Array
+}
+
+/**
+ * Suggestions for a misspelled word, ordered by most likely to be correct.
+ */
+export interface Suggestions extends Array<string> {
+  /**
+   * Set if `timeoutMs` passed before all suggestions were found, in which
+   * case these are the ones found until then.
+   */
+  timedOut?: true
+}
+
+/**
+ * Results of a batch method, one per given word, in order. Strings are
+ * decoded on access.
+ */
+export interface BatchResults<T> extends Iterable<T> {
+  /** Number of results, which is the number of given words. */
+  readonly length: number
+
+  /**
+   * Whether `timeoutMs` passed before the suggestions of any word were all
+   * found. Always false for other methods.
+   */
+  readonly timedOut: boolean
+
+  /**
+   * Get the result of the word at the given index. Negative indices count
+   * back from the end.
    */
-  aff: string
+  at (index: number): T | undefined
+
+  /** Decode all results into an array. */
+  toArray (): T[]
+}
 
+/**
+ * Options for {@link Hunspell.checkText()}.
+ */
+export interface CheckTextOptions {
   /**
-   * Path to the dictionary file.
+   * Characters to consider part of words, in addition to letters, digits and
+   * the word characters of the dictionary (see
+   * {@link Hunspell.getWordCharacters()}).
    */
-  dic: string
+  wordCharacters?: string
 }
 
 /**
@@ -22,8 +307,9 @@ export class Hunspell {
    * Create a new instance of Hunspell.
    *
    * @param dictionary Hunspell dictionary.
+   * @param options Options.
    */
-  constructor (dictionary: Dictionary)
+  constructor (dictionary: Dictionary, options?: HunspellOptions)
 
   /**
    * Create a new instance of Hunspell. This is an alternative function
@@ -34,12 +320,60 @@ export class Hunspell {
    */
   constructor (affix: string, dictionary: string)
 
+  /**
+   * Create a new instance of Hunspell, loading the dictionary in a background
+   * thread so that the event loop is not blocked.
+   *
+   * @param dictionary Hunspell dictionary.
+   * @param options Options.
+   */
+  static load (dictionary: Dictionary, options?: HunspellOptions & AsyncOptions): Promise<Hunspell>
+
+  /**
+   * Create a new instance of Hunspell, loading the dictionary in a background
+   * thread so that the event loop is not blocked.
+   *
+   * @param affix Path to the affix file.
+   * @param dictionary Path to the dictionary file.
+   */
+  static load (affix: string, dictionary: string): Promise<Hunspell>
+
+  /**
+   * Write the words of a dictionary to a file in a compiled form, which is
+   * loaded without parsing when passed as the `dic` of the same affix file.
+   *
+   * @param dictionary Hunspell dictionary.
+   * @param output Path of the file to write.
+   */
+  static compile (dictionary: Dictionary, output: string): Promise<void>
+
+  /**
+   * Run asynchronous operations of all instances in the process on threads
+   * owned by this module, instead of the libuv threadpool. Cheap operations
+   * like {@link spell()} run before expensive ones like {@link suggest()}.
+   *
+   * @param size Number of threads, or 0 (the default) to use the libuv
+   * threadpool.
+   */
+  static setThreadPoolSize (size: number): void
+
+  /**
+   * Set the number of threads that parse the lines of each dictionary file
+   * while it's loaded, in all instances in the process. The words are added
+   * in the order of the file, so the result is the same with any number.
+   *
+   * @param threads Number of threads, 1 to parse line by line, or 0 (the
+   * default) for the number of CPU cores, up to 8.
+   */
+  static setLoadThreads (threads: number): void
+
   /**
    * Yields true if the provided `word` is spelled correctly.
    *
    * @param word The word to check.
+   * @param options Options, such as a signal to abort.
    */
-  spell (word: string): Promise<boolean>
+  spell (word: string, options?: AsyncOptions): Promise<boolean>
 
   /**
    * Returns true if the provided `word` is spelled correctly. Synchronous
@@ -49,14 +383,61 @@ export class Hunspell {
    */
   spellSync (word: string): boolean
 
+  /**
+   * Check the spelling of many words at once. Yields a `Uint8Array` with one
+   * element per word, where `1` means the word at that index is spelled
+   * correctly and `0` means it is not.
+   *
+   * @param words The words to check.
+   * @param options Options, such as a signal to abort.
+   */
+  spellBatch (words: string[], options?: AsyncOptions): Promise<Uint8Array>
+
+  /**
+   * Check the spelling of many words at once. Synchronous version of
+   * {@link spellBatch()}.
+   *
+   * @param words The words to check.
+   */
+  spellBatchSync (words: string[]): Uint8Array
+
+  /**
+   * Split UTF-8 text into words and check the spelling of each. Yields a
+   * `Uint32Array` of `(offset, length)` pairs, one pair per misspelled word,
+   * measured in bytes of the UTF-8 encoded text.
+   *
+   * @param text The text to check, as a string or UTF-8 encoded buffer.
+   * @param options Tokenization options.
+   */
+  checkText (text: string | Uint8Array, options?: CheckTextOptions & AsyncOptions): Promise<Uint32Array>
+
+  /**
+   * Split UTF-8 text into words and check the spelling of each. Synchronous
+   * version of {@link checkText()}.
+   *
+   * @param text The text to check, as a string or UTF-8 encoded buffer.
+   * @param options Tokenization options.
+   */
+  checkTextSync (text: string | Uint8Array, options?: CheckTextOptions): Uint32Array
+
+  /**
+   * Create a transform stream that takes UTF-8 text, of any size, and emits a
+   * {@link Misspelling} object for each misspelled word. Words are checked in
+   * batches by {@link checkText()}, in background threads.
+   *
+   * @param options Batching and tokenization options.
+   */
+  createCheckStream (options?: CheckStreamOptions): Transform
+
   /**
    * Get suggestions to fix spelling. Yields an array of words that could match
    * the provided `word`, ordered by most likely to be correct. Yields `null` if
    * the input `word` is correct.
    *
    * @param word The word to get suggestions for.
+   * @param options Limits on the number of suggestions and time spent.
    */
-  suggest (word: string): Promise<string[] | null>
+  suggest (word: string, options?: SuggestOptions & AsyncOptions): Promise<Suggestions | null>
 
   /**
    * Get suggestions to fix spelling. Returns an array of words that could match
@@ -64,16 +445,38 @@ export class Hunspell {
    * the input `word` is correct. Synchronous version of {@link suggest()}.
    *
    * @param word The word to get suggestions for.
+   * @param options Limits on the number of suggestions and time spent.
+   */
+  suggestSync (word: string, options?: SuggestOptions): Suggestions | null
+
+  /**
+   * Get suggestions for many words at once, spread over threads. Repeated
+   * words are only looked up once. Yields, for each word, what
+   * {@link suggest()} would.
+   *
+   * @param words The words to get suggestions for.
+   * @param options Parallelism, and limits that apply to each word, except
+   * that `timeoutMs` is counted from the call for the whole batch.
    */
-  suggestSync (word: string): string[] | null
+  suggestBatch (words: string[] | PackedWords, options?: SuggestBatchOptions & AsyncOptions): Promise<BatchResults<Suggestions | null>>
+
+  /**
+   * Get suggestions for many words at once. Synchronous version of
+   * {@link suggestBatch()}, which ignores the `parallelism` option.
+   *
+   * @param words The words to get suggestions for.
+   * @param options Limits that apply to each word.
+   */
+  suggestBatchSync (words: string[] | PackedWords, options?: SuggestOptions): BatchResults<Suggestions | null>
 
   /**
    * Yields a morphological analysis of a word. Consult upstream documentation
    * for details on the notation.
    *
    * @param word The word to analyze.
+   * @param options Options, such as a signal to abort.
    */
-  analyze (word: string): Promise<string[]>
+  analyze (word: string, options?: AsyncOptions): Promise<string[]>
 
   /**
    * Returns a morphological analysis of a word. Consult upstream documentation
@@ -83,12 +486,32 @@ export class Hunspell {
    */
   analyzeSync (word: string): string[]
 
+  /**
+   * Analyze many words at once, spread over threads. Repeated words are only
+   * analyzed once, and with the `cacheSize` option, words analyzed before are
+   * remembered across batches. Yields, for each word, what
+   * {@link analyze()} would.
+   *
+   * @param words The words to analyze, as an array or packed.
+   * @param options Parallelism, and a signal to abort.
+   */
+  analyzeBatch (words: string[] | PackedWords, options?: BatchOptions & AsyncOptions): Promise<BatchResults<string[]>>
+
+  /**
+   * Analyze many words at once. Synchronous version of
+   * {@link analyzeBatch()}.
+   *
+   * @param words The words to analyze, as an array or packed.
+   */
+  analyzeBatchSync (words: string[] | PackedWords): BatchResults<string[]>
+
   /**
    * Get the stems (root forms) of a word.
    *
    * @param word The word to stem.
+   * @param options Options, such as a signal to abort.
    */
-  stem (word: string): Promise<string[]>
+  stem (word: string, options?: AsyncOptions): Promise<string[]>
 
   /**
    * Returns the stems (root forms) of a word. Synchronous version of
@@ -98,14 +521,33 @@ export class Hunspell {
    */
   stemSync (word: string): string[]
 
+  /**
+   * Stem many words at once, spread over threads. Repeated words are only
+   * stemmed once, and with the `cacheSize` option, words stemmed before are
+   * remembered across batches. Yields, for each word, what {@link stem()}
+   * would.
+   *
+   * @param words The words to stem, as an array or packed.
+   * @param options Parallelism, and a signal to abort.
+   */
+  stemBatch (words: string[] | PackedWords, options?: BatchOptions & AsyncOptions): Promise<BatchResults<string[]>>
+
+  /**
+   * Stem many words at once. Synchronous version of {@link stemBatch()}.
+   *
+   * @param words The words to stem, as an array or packed.
+   */
+  stemBatchSync (words: string[] | PackedWords): BatchResults<string[]>
+
   /**
    * Generates a variation of a word by matching the morphological structure of
    * the second word.
    *
    * @param word The word to generate variations of.
    * @param example The example word whose morphological structure to match.
+   * @param options Options, such as a signal to abort.
    */
-  generate (word: string, example: string): Promise<string[]>
+  generate (word: string, example: string, options?: AsyncOptions): Promise<string[]>
 
   /**
    * Synchronously generates a variation of a word by matching the morphological
@@ -119,25 +561,28 @@ export class Hunspell {
   /**
    * Add a dictionary file with additional words.
    *
-   * @param dictionaryFile Path of the dictionary file to add.
+   * @param dictionaryFile Path of the dictionary file to add, or its contents,
+   * which must not be modified until the promise settles.
+   * @param options Options, such as a signal to abort.
    */
-  addDictionary (dictionaryFile: string): Promise<void>
+  addDictionary (dictionaryFile: string | Uint8Array, options?: AsyncOptions): Promise<void>
 
   /**
    * Add a dictionary file with additional words. Synchronous version of
    * {@link addDictionary()}.
    *
-   * @param dictionaryFile Path of the dictionary file to add.
+   * @param dictionaryFile Path of the dictionary file to add, or its contents.
    */
-  addDictionarySync (dictionaryFile: string): void
+  addDictionarySync (dictionaryFile: string | Uint8Array): void
 
   /**
    * Add a single word, which can also contain flags (as if it was a line in a
    * dictionary file).
    *
    * @param word The word to add.
+   * @param options Options, such as a signal to abort.
    */
-  add (word: string): Promise<void>
+  add (word: string, options?: AsyncOptions): Promise<void>
 
   /**
    * Add a single word. Synchronous version of {@link add()}.
@@ -152,8 +597,9 @@ export class Hunspell {
    *
    * @param word The word to add.
    * @param example The example word whose affix definition to apply.
+   * @param options Options, such as a signal to abort.
    */
-  addWithAffix (word: string, example: string): Promise<void>
+  addWithAffix (word: string, example: string, options?: AsyncOptions): Promise<void>
 
   /**
    * Like {@link addSync()} except it also applies the example word's affix
@@ -168,8 +614,9 @@ export class Hunspell {
    * Remove a word. This ignores flags and just strips words that match.
    *
    * @param word The word to remove.
+   * @param options Options, such as a signal to abort.
    */
-  remove (word: string): Promise<void>
+  remove (word: string, options?: AsyncOptions): Promise<void>
 
   /**
    * Remove a word. This ignores flags and just strips words that match.
@@ -179,6 +626,55 @@ export class Hunspell {
    */
   removeSync (word: string): void
 
+  /**
+   * Add many words at once, with a single write lock. Like {@link add()} for
+   * each word.
+   *
+   * @param words The words to add.
+   * @param options Options, such as a signal to abort.
+   */
+  addMany (words: string[], options?: AsyncOptions): Promise<void>
+
+  /**
+   * Add many words at once. Synchronous version of {@link addMany()}.
+   *
+   * @param words The words to add.
+   */
+  addManySync (words: string[]): void
+
+  /**
+   * Like {@link addWithAffix()} for each pair, with a single write lock.
+   *
+   * @param pairs Pairs of a word to add and the example word whose affix
+   * definition to apply.
+   * @param options Options, such as a signal to abort.
+   */
+  addManyWithAffix (pairs: Array<[word: string, example: string]>, options?: AsyncOptions): Promise<void>
+
+  /**
+   * Synchronous version of {@link addManyWithAffix()}.
+   *
+   * @param pairs Pairs of a word to add and the example word whose affix
+   * definition to apply.
+   */
+  addManyWithAffixSync (pairs: Array<[word: string, example: string]>): void
+
+  /**
+   * Remove many words at once, with a single write lock. Like
+   * {@link remove()} for each word.
+   *
+   * @param words The words to remove.
+   * @param options Options, such as a signal to abort.
+   */
+  removeMany (words: string[], options?: AsyncOptions): Promise<void>
+
+  /**
+   * Remove many words at once. Synchronous version of {@link removeMany()}.
+   *
+   * @param words The words to remove.
+   */
+  removeManySync (words: string[]): void
+
   /**
    * Get the characters that are considered valid within words. Useful for
    * tokenization.
@@ -187,4 +683,19 @@ export class Hunspell {
    * lacks this information.
    */
   getWordCharacters (): string | undefined
+
+  /**
+   * Get counters of the result cache enabled by the `cacheSize` option.
+   *
+   * @returns The counters, or `undefined` if caching is disabled.
+   */
+  getCacheStats (): CacheStats | undefined
+
+  /**
+   * Get counters and latency histograms of the operations on this instance's
+   * dictionary. Batch variants count as the operation they consist of, for
+   * example {@link Hunspell.checkText()} as `spell` and
+   * {@link Hunspell.addDictionary()} as `add`.
+   */
+  stats (): Stats
 }
@@ -1,5 +1,9 @@
 import { fail, strictEqual, throws, deepEqual, notEqual } from 'node:assert'
 import { describe, it, beforeEach } from 'node:test'
+import { readFileSync, rmSync } from 'node:fs'
+import { tmpdir } from 'node:os'
+import { join } from 'node:path'
+import { Readable } from 'node:stream'
 import { Hunspell } from '../index.js'
 
 // TODO: consider replacing with https://www.npmjs.com/package/language-packages
@@ -58,6 +62,386 @@ describe('Hunspell(..)', () => {
     const hunspell = new Hunspell({ aff: enUS.affix, dic: enUS.dictionary })
     strictEqual(hunspell instanceof Hunspell, true)
   })
+  it('should successfully construct an object when buffers are given', () => {
+    const hunspell = new Hunspell({
+      aff: readFileSync(enUS.affix),
+      dic: readFileSync(enUS.dictionary)
+    })
+
+    strictEqual(hunspell.spellSync('color'), true)
+    strictEqual(hunspell.spellSync('colour'), false)
+    strictEqual(hunspell.getWordCharacters(), '0123456789\'.-’')
+  })
+
+  it('should throw when the dictionary is invalid', () => {
+    throws(() => new Hunspell({ aff: enUS.affix }))
+    throws(() => new Hunspell({ aff: enUS.affix, dic: 1 }))
+    throws(() => new Hunspell({ aff: [], dic: enUS.dictionary }))
+  })
+
+  it('should throw when the options are invalid', () => {
+    const dictionary = { aff: enUS.affix, dic: enUS.dictionary }
+
+    throws(() => new Hunspell(dictionary, 1))
+    throws(() => new Hunspell(dictionary, { concurrency: 0 }))
+    throws(() => new Hunspell(dictionary, { concurrency: 1.5 }))
+    throws(() => new Hunspell(dictionary, { concurrency: '2' }))
+  })
+})
+
+describe('Hunspell.load(..)', () => {
+  it('should be a function', () => {
+    strictEqual(typeof Hunspell.load, 'function')
+  })
+
+  it('should throw when no arguments are given', async () => {
+    try {
+      await Hunspell.load()
+      fail()
+    } catch {
+      // success
+    }
+  })
+
+  it('should throw when the second argument is invalid', async () => {
+    try {
+      await Hunspell.load(enUS.affix, 2)
+      fail()
+    } catch {
+      // success
+    }
+  })
+
+  it('should throw when the options are invalid', async () => {
+    try {
+      await Hunspell.load({ aff: enUS.affix, dic: enUS.dictionary }, { concurrency: 0 })
+      fail()
+    } catch {
+      // success
+    }
+  })
+
+  it('should yield an instance when two strings are given', async () => {
+    const hunspell = await Hunspell.load(enUS.affix, enUS.dictionary)
+
+    strictEqual(hunspell instanceof Hunspell, true)
+    strictEqual(await hunspell.spell('color'), true)
+    strictEqual(hunspell.spellSync('colour'), false)
+  })
+
+  it('should yield an instance when a dictionary and options are given', async () => {
+    const hunspell = await Hunspell.load({
+      aff: readFileSync(enUS.affix),
+      dic: enUS.dictionary
+    }, { concurrency: 2 })
+
+    strictEqual(hunspell instanceof Hunspell, true)
+    deepEqual(await Promise.all([hunspell.spell('color'), hunspell.spell('colour')]), [true, false])
+  })
+
+  it('should keep an affix file given as a buffer for addDictionary()', async () => {
+    const hunspell = await Hunspell.load({
+      aff: readFileSync(enUS.affix),
+      dic: readFileSync(enUS.dictionary)
+    })
+
+    // The flags of the added word are only known from the affix file
+    await hunspell.addDictionary(Buffer.from('1\ncolour/23\n'))
+    strictEqual(await hunspell.spell('colouring'), true)
+  })
+})
+
+describe('Hunspell.compile(dictionary, output)', () => {
+  const output = join(tmpdir(), `hunspell-${process.pid}.dic`)
+
+  it('should reject invalid arguments', async () => {
+    for (const args of [[], [{ aff: enUS.affix }, output], [{ aff: enUS.affix, dic: enUS.dictionary }, 1]]) {
+      try {
+        await Hunspell.compile(...args)
+        fail('expected rejection')
+      } catch {}
+    }
+  })
+
+  it('should load the same words as the dictionary file', async () => {
+    await Hunspell.compile({ aff: enUS.affix, dic: enUS.dictionary }, output)
+
+    try {
+      const parsed = new Hunspell({ aff: enUS.affix, dic: enUS.dictionary })
+      const compiled = new Hunspell({ aff: enUS.affix, dic: readFileSync(output) })
+      const loaded = await Hunspell.load({ aff: enUS.affix, dic: output }, { suggestIndex: true })
+
+      for (const word of ['color', 'colour', 'coloring', 'Paris', 'paris', 'OK', 'abandonment']) {
+        strictEqual(compiled.spellSync(word), parsed.spellSync(word))
+        strictEqual(await loaded.spell(word), parsed.spellSync(word))
+      }
+
+      deepEqual(compiled.suggestSync('colour'), parsed.suggestSync('colour'))
+      deepEqual(compiled.analyzeSync('colored'), parsed.analyzeSync('colored'))
+      deepEqual(compiled.stemSync('colored'), parsed.stemSync('colored'))
+      strictEqual((await loaded.suggest('calor', { engine: 'indexed' }))[0], 'color')
+    } finally {
+      rmSync(output)
+    }
+  })
+
+  it('should load no words with another affix file', async () => {
+    await Hunspell.compile({ aff: enUS.affix, dic: enUS.dictionary }, output)
+
+    try {
+      const hunspell = new Hunspell({ aff: enGB.affix, dic: output })
+      strictEqual(hunspell.spellSync('color'), false)
+    } finally {
+      rmSync(output)
+    }
+  })
+})
+
+describe('Hunspell(dictionary, { concurrency })', () => {
+  const hunspell = new Hunspell({ aff: enUS.affix, dic: enUS.dictionary }, { concurrency: 3 })
+
+  it('should handle parallel reads', async () => {
+    const words = Array(50).fill(['color', 'colour']).flat()
+    const results = await Promise.all(words.map(word => hunspell.spell(word)))
+    const suggestions = await Promise.all(words.map(word => hunspell.suggest(word)))
+
+    deepEqual(results, words.map(word => word === 'color'))
+    deepEqual(suggestions[0], null)
+    deepEqual(suggestions[1].slice(0, 3), ['color', 'co lour', 'co-lour'])
+  })
+
+  it('should apply writes to every instance', async () => {
+    await hunspell.add('npm')
+    hunspell.addSync('npx')
+
+    const results = await Promise.all(Array(10).fill(['npm', 'npx']).flat().map(word => hunspell.spell(word)))
+    strictEqual(results.every(Boolean), true)
+
+    await hunspell.remove('npm')
+    hunspell.removeSync('npx')
+
+    const removed = await Promise.all(Array(10).fill(['npm', 'npx']).flat().map(word => hunspell.spell(word)))
+    strictEqual(removed.some(Boolean), false)
+  })
+})
+
+describe('Hunspell(dictionary, { shared })', () => {
+  const dictionary = { aff: enUS.affix, dic: enUS.dictionary }
+
+  it('should throw when the option is invalid', () => {
+    throws(() => new Hunspell(dictionary, { shared: 1 }))
+  })
+
+  it('should share a dictionary', async () => {
+    const a = new Hunspell(dictionary, { shared: true })
+    const b = new Hunspell(dictionary, { shared: true })
+
+    strictEqual(a.spellSync('color'), true)
+    strictEqual(await b.spell('color'), true)
+    deepEqual(await b.suggest('colour').then(s => s.slice(0, 1)), ['color'])
+  })
+
+  it('should not share writes', async () => {
+    const a = new Hunspell(dictionary, { shared: true })
+    const b = new Hunspell(dictionary, { shared: true })
+
+    a.addSync('npm')
+    await b.add('npx')
+
+    strictEqual(a.spellSync('npm'), true)
+    strictEqual(a.spellSync('npx'), false)
+    strictEqual(b.spellSync('npm'), false)
+    strictEqual(b.spellSync('npx'), true)
+    strictEqual(new Hunspell(dictionary, { shared: true }).spellSync('npm'), false)
+  })
+
+  it('should not share removals of shared words', async () => {
+    const a = new Hunspell(dictionary, { shared: true })
+    const b = new Hunspell(dictionary, { shared: true })
+
+    await a.remove('color')
+
+    strictEqual(a.spellSync('color'), false)
+    strictEqual(b.spellSync('color'), true)
+  })
+
+  it('should keep the flags of a shared word that is added again', async () => {
+    const a = new Hunspell(dictionary, { shared: true })
+    const b = new Hunspell(dictionary, { shared: true })
+
+    await a.add('color')
+
+    strictEqual(a.spellSync('colors'), true)
+    strictEqual(a.spellSync('coloring'), true)
+    strictEqual(b.spellSync('color'), true)
+  })
+})
+
+describe('Hunspell(dictionary, { cacheSize })', () => {
+  const dictionary = { aff: enUS.affix, dic: enUS.dictionary }
+
+  it('should throw when the option is invalid', () => {
+    throws(() => new Hunspell(dictionary, { cacheSize: -1 }))
+    throws(() => new Hunspell(dictionary, { cacheSize: 1.5 }))
+    throws(() => new Hunspell(dictionary, { cacheSize: '10' }))
+  })
+
+  it('should not cache by default', () => {
+    strictEqual(new Hunspell(dictionary).getCacheStats(), undefined)
+    strictEqual(new Hunspell(dictionary, { cacheSize: 0 }).getCacheStats(), undefined)
+  })
+
+  it('should cache results', async () => {
+    const hunspell = new Hunspell(dictionary, { cacheSize: 10 })
+
+    deepEqual(hunspell.suggestSync('colour').slice(0, 1), ['color'])
+    deepEqual((await hunspell.suggest('colour')).slice(0, 1), ['color'])
+    strictEqual(hunspell.suggestSync('color'), null)
+    strictEqual(await hunspell.spell('colour'), false)
+    strictEqual(hunspell.spellSync('colour'), false)
+    deepEqual(hunspell.stemSync('telling'), ['telling', 'tell'])
+    deepEqual(await hunspell.stem('telling'), ['telling', 'tell'])
+
+    deepEqual(hunspell.getCacheStats(), { hits: 3, misses: 4, size: 4, capacity: 10 })
+  })
+
+  it('should evict the least recently used results', () => {
+    const hunspell = new Hunspell(dictionary, { cacheSize: 2 })
+
+    hunspell.spellSync('a')
+    hunspell.spellSync('b')
+    hunspell.spellSync('a')
+    hunspell.spellSync('c')
+    hunspell.spellSync('a')
+    hunspell.spellSync('b')
+
+    deepEqual(hunspell.getCacheStats(), { hits: 2, misses: 4, size: 2, capacity: 2 })
+  })
+
+  it('should discard results on writes', async () => {
+    const hunspell = new Hunspell(dictionary, { cacheSize: 10 })
+
+    strictEqual(hunspell.spellSync('npm'), false)
+    hunspell.addSync('npm')
+    strictEqual(hunspell.getCacheStats().size, 0)
+    strictEqual(hunspell.spellSync('npm'), true)
+
+    await hunspell.remove('npm')
+    strictEqual(await hunspell.spell('npm'), false)
+  })
+})
+
+describe('Hunspell(dictionary, { lockFreeReads })', () => {
+  const dictionary = { aff: enUS.affix, dic: enUS.dictionary }
+
+  it('should throw when the option is invalid', () => {
+    throws(() => new Hunspell(dictionary, { lockFreeReads: 1 }))
+    throws(() => new Hunspell(dictionary, { lockFreeReads: 'true' }))
+  })
+
+  it('should apply writes to both copies', async () => {
+    const hunspell = new Hunspell(dictionary, { lockFreeReads: true, cacheSize: 10 })
+
+    strictEqual(hunspell.spellSync('npm'), false)
+    hunspell.addSync('npm')
+    strictEqual(hunspell.spellSync('npm'), true)
+    await hunspell.addMany(['npx', 'nvm'])
+    deepEqual(await Promise.all(['npm', 'npx', 'nvm'].map((word) => hunspell.spell(word))), [true, true, true])
+
+    hunspell.removeSync('npm')
+    strictEqual(hunspell.spellSync('npm'), false)
+    strictEqual(await hunspell.spell('npm'), false)
+  })
+
+  it('should read while writing', async () => {
+    const hunspell = new Hunspell(dictionary, { lockFreeReads: true, concurrency: 2 })
+    const words = Array.from({ length: 50 }, (_, i) => `npm${i}`)
+
+    const [spellings] = await Promise.all([
+      Promise.all(words.map(() => hunspell.spell('color'))),
+      Promise.all(words.map((word) => hunspell.add(word)))
+    ])
+
+    deepEqual(spellings, words.map(() => true))
+    deepEqual(Array.from(hunspell.spellBatchSync(words)), words.map(() => 1))
+  })
+})
+
+describe('Hunspell(dictionary, { suggestIndex })', () => {
+  const dictionary = { aff: enUS.affix, dic: enUS.dictionary }
+  const hunspell = new Hunspell(dictionary, { suggestIndex: true, cacheSize: 10 })
+
+  it('should throw when the option is invalid', () => {
+    throws(() => new Hunspell(dictionary, { suggestIndex: 1 }))
+    throws(() => new Hunspell(dictionary, { suggestIndex: 'true' }))
+  })
+
+  it('should throw when the engine is invalid', () => {
+    throws(() => hunspell.suggestSync('calor', { engine: 'ngram' }))
+    throws(() => hunspell.suggestSync('calor', { engine: 1 }))
+    throws(() => new Hunspell(dictionary).suggestSync('calor', { engine: 'indexed' }))
+    deepEqual(new Hunspell(dictionary).suggestSync('calor', { engine: 'hunspell' }), new Hunspell(dictionary).suggestSync('calor'))
+  })
+
+  it('should suggest words one and two edits away', async () => {
+    strictEqual(hunspell.suggestSync('calor', { engine: 'indexed' })[0], 'color')
+    strictEqual(hunspell.suggestSync('dictinry', { engine: 'indexed' }).includes('dictionary'), true)
+    strictEqual((await hunspell.suggest('dictinry', { engine: 'indexed' })).includes('dictionary'), true)
+  })
+
+  it('should return null for correct words', async () => {
+    strictEqual(hunspell.suggestSync('color', { engine: 'indexed' }), null)
+    strictEqual(await hunspell.suggest('color', { engine: 'indexed' }), null)
+  })
+
+  it('should return at most maxSuggestions suggestions', () => {
+    strictEqual(hunspell.suggestSync('calor', { engine: 'indexed' }).length <= 15, true)
+    deepEqual(hunspell.suggestSync('calor', { engine: 'indexed', maxSuggestions: 1 }), ['color'])
+  })
+
+  it('should work in batches', async () => {
+    const results = await hunspell.suggestBatch(['calor', 'color', 'calor'], { engine: 'indexed' })
+
+    strictEqual(results.at(0)[0], 'color')
+    strictEqual(results.at(1), null)
+    deepEqual(results.at(2), results.at(0))
+  })
+})
+
+describe('Hunspell(dictionary, { wordStore })', () => {
+  const dictionary = { aff: enUS.affix, dic: enUS.dictionary }
+  const words = ['color', 'colour', 'colors', 'Color', 'dictionary', 'dictionry', 'npm', '']
+
+  it('should throw when the option is invalid', () => {
+    throws(() => new Hunspell(dictionary, { wordStore: 1 }))
+    throws(() => new Hunspell(dictionary, { wordStore: 'true' }))
+  })
+
+  it('should spell like Hunspell', async () => {
+    const hunspell = new Hunspell(dictionary, { wordStore: true })
+    const expected = Array.from(new Hunspell(dictionary).spellBatchSync(words))
+
+    deepEqual(Array.from(hunspell.spellBatchSync(words)), expected)
+    deepEqual(Array.from(await hunspell.spellBatch(words)), expected)
+    deepEqual(words.map((word) => hunspell.spellSync(word) ? 1 : 0), expected)
+  })
+
+  it('should not depend on the number of instances', () => {
+    const hunspell = new Hunspell(dictionary, { wordStore: true, suggestIndex: true, concurrency: 3 })
+    const expected = Array.from(new Hunspell(dictionary).spellBatchSync(words))
+
+    deepEqual(Array.from(hunspell.spellBatchSync(words)), expected)
+    strictEqual(hunspell.stats().memoryByStructure.wordStore, new Hunspell(dictionary, { wordStore: true }).stats().memoryByStructure.wordStore)
+  })
+
+  it('should not be used after a write', async () => {
+    const hunspell = new Hunspell(dictionary, { wordStore: true, lockFreeReads: true })
+
+    strictEqual(hunspell.spellSync('color'), true)
+    hunspell.removeSync('color')
+    strictEqual(hunspell.spellSync('color'), false)
+    strictEqual(await hunspell.spell('color'), false)
+  })
 })
 
 describe('Hunspell#spell(word)', () => {
@@ -174,6 +558,18 @@ describe('Hunspell#spellSync(word)', () => {
     strictEqual(hunspell.spellSync('.'), true)
   })
 
+  it('should read long words in full', () => {
+    const hunspell = new Hunspell(enUS.affix, enUS.dictionary)
+
+    // Multi-byte characters around the point where words no longer fit on
+    // the stack
+    for (const word of ['é'.repeat(125) + 'x', 'a' + 'é'.repeat(126), 'x'.repeat(251) + '€']) {
+      hunspell.addSync(word)
+      strictEqual(hunspell.spellSync(word), true)
+      strictEqual(hunspell.spellSync(word.slice(0, -1)), false)
+    }
+  })
+
   it('should check for sentence-case when upper-case (ok)', () => {
     strictEqual(hunspell.spellSync('ABDUL'), true)
   })
@@ -248,6 +644,189 @@ describe('Hunspell#spellSync(word)', () => {
   })
 })
 
+describe('Hunspell#spellBatch(words)', () => {
+  const hunspell = new Hunspell(enUS.affix, enUS.dictionary)
+
+  it('should be a function', () => {
+    strictEqual(typeof hunspell.spellBatch, 'function')
+  })
+
+  it('should throw when 0 arguments are given', async () => {
+    try {
+      await hunspell.spellBatch()
+      fail()
+    } catch {
+      // success
+    }
+  })
+
+  it('should throw when the first argument isn\'t an array', async () => {
+    try {
+      await hunspell.spellBatch('color')
+      fail()
+    } catch {
+      // success
+    }
+  })
+
+  it('should throw when the array contains a non-string', async () => {
+    try {
+      await hunspell.spellBatch(['color', 1])
+      fail()
+    } catch {
+      // success
+    }
+  })
+
+  it('should return a Uint8Array with one element per word', async () => {
+    const result = await hunspell.spellBatch(['color', 'colour', 'c'])
+    strictEqual(result instanceof Uint8Array, true)
+    deepEqual(Array.from(result), [1, 0, 1])
+  })
+
+  it('should return an empty Uint8Array for an empty array', async () => {
+    strictEqual((await hunspell.spellBatch([])).length, 0)
+  })
+})
+
+describe('Hunspell#spellBatchSync(words)', () => {
+  const hunspell = new Hunspell(enUS.affix, enUS.dictionary)
+
+  it('should be a function', () => {
+    strictEqual(typeof hunspell.spellBatchSync, 'function')
+  })
+
+  it('should throw when 0 arguments are given', () => {
+    throws(() => hunspell.spellBatchSync())
+  })
+
+  it('should throw when the array contains a non-string', () => {
+    throws(() => hunspell.spellBatchSync(['color', 1]))
+  })
+
+  it('should match spellSync()', () => {
+    const words = ['color', 'colour', 'ABDUL', 'COLOUR', '21st', '20st', ' ']
+    const expected = words.map(word => hunspell.spellSync(word) ? 1 : 0)
+
+    deepEqual(Array.from(hunspell.spellBatchSync(words)), expected)
+  })
+})
+
+describe('Hunspell#checkText(text, options)', () => {
+  const hunspell = new Hunspell(enUS.affix, enUS.dictionary)
+
+  it('should be a function', () => {
+    strictEqual(typeof hunspell.checkText, 'function')
+  })
+
+  it('should throw when 0 arguments are given', async () => {
+    try {
+      await hunspell.checkText()
+      fail()
+    } catch {
+      // success
+    }
+  })
+
+  it('should throw when the first argument isn\'t a string or buffer', async () => {
+    try {
+      await hunspell.checkText(123)
+      fail()
+    } catch {
+      // success
+    }
+  })
+
+  it('should throw when the options are invalid', async () => {
+    try {
+      await hunspell.checkText('color', { wordCharacters: 1 })
+      fail()
+    } catch {
+      // success
+    }
+  })
+
+  it('should return byte ranges of misspelled words', async () => {
+    const text = Buffer.from('The colour of “flavour” is nice')
+    const ranges = await hunspell.checkText(text)
+    const words = []
+
+    strictEqual(ranges instanceof Uint32Array, true)
+
+    for (let i = 0; i < ranges.length; i += 2) {
+      words.push(text.toString('utf8', ranges[i], ranges[i] + ranges[i + 1]))
+    }
+
+    deepEqual(words, ['colour', 'flavour'])
+  })
+
+  it('should accept a string', async () => {
+    deepEqual(Array.from(await hunspell.checkText('color colour')), [6, 6])
+  })
+
+  it('should return an empty array when all words are correct', async () => {
+    strictEqual((await hunspell.checkText('21st-century color, isn\'t it?')).length, 0)
+  })
+})
+
+describe('Hunspell#checkTextSync(text, options)', () => {
+  const hunspell = new Hunspell(enUS.affix, enUS.dictionary)
+  const hunspellGB = new Hunspell(enGB.affix, enGB.dictionary)
+
+  it('should be a function', () => {
+    strictEqual(typeof hunspell.checkTextSync, 'function')
+  })
+
+  it('should throw when 0 arguments are given', () => {
+    throws(() => hunspell.checkTextSync())
+  })
+
+  it('should throw when the options are invalid', () => {
+    throws(() => hunspell.checkTextSync('color', 1))
+  })
+
+  it('should return byte ranges of misspelled words', () => {
+    deepEqual(Array.from(hunspell.checkTextSync('😀 colour')), [5, 6])
+  })
+
+  it('should support additional word characters', () => {
+    deepEqual(Array.from(hunspellGB.checkTextSync('colour-ful')), [7, 3])
+    deepEqual(Array.from(hunspellGB.checkTextSync('colour-ful', { wordCharacters: '-' })), [0, 10])
+  })
+})
+
+describe('Hunspell#createCheckStream(options)', () => {
+  const hunspell = new Hunspell(enGB.affix, enGB.dictionary)
+
+  it('should throw when the options are invalid', () => {
+    throws(() => hunspell.createCheckStream({ batchSize: 0 }))
+    throws(() => hunspell.createCheckStream({ maxInFlight: 1.5 }))
+  })
+
+  it('should emit misspellings', async () => {
+    const text = Array(2000).fill('A colour, a colur and a naive céfé.').join('\n')
+    const buffer = Buffer.from(text)
+    const expected = Array.from(hunspell.checkTextSync(buffer))
+    const chunks = []
+
+    // Split words and characters across chunks
+    for (let i = 0; i < buffer.length; i += 7) {
+      chunks.push(buffer.subarray(i, i + 7))
+    }
+
+    const stream = Readable.from(chunks).pipe(hunspell.createCheckStream({ batchSize: 512 }))
+    const misspellings = await stream.toArray()
+
+    strictEqual(misspellings.length * 2, expected.length)
+    deepEqual(misspellings.flatMap(m => [m.offset, m.length]), expected)
+    deepEqual(misspellings.slice(0, 2).map(m => m.word), ['colur', 'céfé'])
+  })
+
+  it('should emit nothing for empty input', async () => {
+    deepEqual(await Readable.from([]).pipe(hunspell.createCheckStream()).toArray(), [])
+  })
+})
+
 describe('Hunspell#suggestSync(word)', () => {
   const hunspell = new Hunspell(enUS.affix, enUS.dictionary)
 
@@ -396,6 +975,17 @@ describe('Hunspell#suggestSync(word)', () => {
     const word = 'npmnpmnpmnpmnpmnpmnpmnpmnpmnpmnpmnpmnpmnpmnpm'
     deepEqual(hunspell.suggestSync(word), [])
   })
+
+  it('should throw when the options are invalid', () => {
+    throws(() => hunspell.suggestSync('colour', 1))
+    throws(() => hunspell.suggestSync('colour', { maxSuggestions: 0 }))
+    throws(() => hunspell.suggestSync('colour', { timeoutMs: -1 }))
+  })
+
+  it('should return at most maxSuggestions suggestions', () => {
+    deepEqual(hunspell.suggestSync('colour', { maxSuggestions: 1 }), ['color'])
+    deepEqual(hunspell.suggestSync('colour', { maxSuggestions: 2, timeoutMs: 1000 }), ['color', 'co lour'])
+  })
 })
 
 describe('Hunspell#suggest(word)', () => {
@@ -458,12 +1048,149 @@ describe('Hunspell#suggest(word)', () => {
     deepEqual(value.splice(0, 3), ['color', 'co lour', 'co-lour'])
   })
 
+  it('should throw when the options are invalid', async () => {
+    for (const options of [1, { maxSuggestions: 0 }, { maxSuggestions: 1.5 }, { timeoutMs: -1 }, { timeoutMs: '1' }]) {
+      try {
+        await hunspell.suggest('colour', options)
+        fail()
+      } catch {
+        // success
+      }
+    }
+  })
+
+  it('should return at most maxSuggestions suggestions', async () => {
+    deepEqual(await hunspell.suggest('colour', { maxSuggestions: 1 }), ['color'])
+    deepEqual(await hunspell.suggest('colour', { maxSuggestions: 3 }), ['color', 'co lour', 'co-lour'])
+    strictEqual(await hunspell.suggest('color', { maxSuggestions: 1 }), null)
+  })
+
+  it('should report that the timeout expired', async () => {
+    const suggestions = await hunspell.suggest('colour', { timeoutMs: 0 })
+
+    deepEqual([...suggestions], [])
+    strictEqual(suggestions.timedOut, true)
+    strictEqual(hunspell.suggestSync('colour', { timeoutMs: 0 }).timedOut, true)
+    strictEqual(await hunspell.suggest('color', { timeoutMs: 0 }), null)
+    strictEqual((await hunspell.suggest('colour', { timeoutMs: 1000 })).timedOut, undefined)
+  })
+
+  it('should not cache suggestions cut short by the timeout', async () => {
+    const cached = new Hunspell({ aff: enUS.affix, dic: enUS.dictionary }, { cacheSize: 10 })
+
+    strictEqual((await cached.suggest('colour', { timeoutMs: 0 })).timedOut, true)
+    deepEqual(await cached.suggest('colour'), await hunspell.suggest('colour'))
+  })
+
+  it('should return the same suggestions with or without the cache', async () => {
+    const cached = new Hunspell({ aff: enUS.affix, dic: enUS.dictionary }, { cacheSize: 10 })
+
+    deepEqual(await cached.suggest('colour', { maxSuggestions: 2 }), ['color', 'co lour'])
+    deepEqual(await cached.suggest('colour', { maxSuggestions: 2 }), ['color', 'co lour'])
+    deepEqual(await cached.suggest('colour'), await hunspell.suggest('colour'))
+  })
+
   // it(`should not throw when suggesting for emojis ☀`, async () => {
   //     await hunspell.suggest('😀')
   //     await hunspell.suggest('☀')
   // })
 })
 
+describe('Hunspell#suggestBatch(words, options)', () => {
+  const hunspell = new Hunspell({ aff: enUS.affix, dic: enUS.dictionary }, { concurrency: 2 })
+  const words = ['colour', 'color', 'behaviour', 'colour', 'naïeve']
+
+  it('should reject invalid arguments', async () => {
+    for (const args of [[], ['colour'], [['colour', 1]], [words, { parallelism: 0 }], [words, { parallelism: 1.5 }], [words, { maxSuggestions: 0 }]]) {
+      try {
+        await hunspell.suggestBatch(...args)
+        fail()
+      } catch (err) {
+        strictEqual(err instanceof Error, true)
+      }
+    }
+  })
+
+  it('should match suggestSync()', async () => {
+    const expected = words.map((word) => hunspell.suggestSync(word))
+
+    for (const parallelism of [1, 2, 8]) {
+      const results = await hunspell.suggestBatch(words, { parallelism })
+
+      strictEqual(results.length, words.length)
+      deepEqual(results.toArray(), expected)
+      deepEqual([...results], expected)
+      deepEqual(results.at(-1), expected[4])
+      strictEqual(results.at(5), undefined)
+    }
+
+    deepEqual(hunspell.suggestBatchSync(words).toArray(), expected)
+  })
+
+  it('should look up repeated words once', async () => {
+    const hunspell = new Hunspell(enUS.affix, enUS.dictionary)
+    const results = await hunspell.suggestBatch(words)
+
+    strictEqual(results.at(0), results.at(3))
+    strictEqual(hunspell.stats().operations.suggest.calls, 4)
+  })
+
+  it('should spread over the threadpool with a single instance', async () => {
+    const hunspell = new Hunspell({ aff: enUS.affix, dic: enUS.dictionary })
+    const expected = words.map((word) => hunspell.suggestSync(word))
+
+    // The default parallelism is the size of the threadpool, not the
+    // number of instances
+    deepEqual((await hunspell.suggestBatch(words)).toArray(), expected)
+    deepEqual((await hunspell.suggestBatch(words, { parallelism: 4 })).toArray(), expected)
+  })
+
+  it('should accept an empty array', async () => {
+    strictEqual((await hunspell.suggestBatch([])).length, 0)
+    strictEqual(hunspell.suggestBatchSync([]).length, 0)
+  })
+
+  it('should accept more parallelism than instances', async () => {
+    const results = await hunspell.suggestBatch(words, { parallelism: 64, maxSuggestions: 1 })
+
+    deepEqual(results.at(0), ['color'])
+  })
+
+  it('should apply limits', async () => {
+    const results = await hunspell.suggestBatch(words, { maxSuggestions: 1 })
+
+    deepEqual(results.at(0), ['color'])
+    strictEqual(results.at(1), null)
+    strictEqual(results.timedOut, false)
+  })
+
+  it('should report the words that timed out', async () => {
+    const results = await hunspell.suggestBatch(words, { timeoutMs: 0 })
+
+    strictEqual(results.timedOut, true)
+    strictEqual(results.at(0).timedOut, true)
+    strictEqual(results.at(1), null)
+    strictEqual(hunspell.suggestBatchSync(words, { timeoutMs: 0 }).timedOut, true)
+  })
+
+  it('should reject when aborted', async () => {
+    const controller = new AbortController()
+    const promise = hunspell.suggestBatch(words, { signal: controller.signal })
+
+    controller.abort()
+
+    try {
+      await promise
+      fail()
+    } catch (err) {
+      strictEqual(err.name, 'AbortError')
+    }
+
+    // Helpers stop too, and the instance remains usable
+    deepEqual(await hunspell.suggest('color'), null)
+  })
+})
+
 describe('Hunspell#add(word)', () => {
   let hunspell
 
@@ -731,6 +1458,59 @@ describe('Hunspell#removeSync(value)', () => {
 //   st.end();
 // });
 
+describe('Hunspell#addMany(words) and removeMany(words)', () => {
+  const hunspell = new Hunspell({ aff: enUS.affix, dic: enUS.dictionary }, { concurrency: 2 })
+  const words = Array.from({ length: 1000 }, (_, i) => `npm${i}x`)
+
+  it('should reject when the arguments are invalid', async () => {
+    for (const call of [
+      () => hunspell.addMany(),
+      () => hunspell.addMany('npm'),
+      () => hunspell.addMany(['npm', 1]),
+      () => hunspell.removeMany([1]),
+      () => hunspell.addManyWithAffix(['npm']),
+      () => hunspell.addManyWithAffix([['npm']])
+    ]) {
+      try {
+        await call()
+        fail()
+      } catch {
+        // success
+      }
+    }
+  })
+
+  it('should throw when the arguments are invalid', () => {
+    throws(() => hunspell.addManySync())
+    throws(() => hunspell.addManySync(['npm', 1]))
+    throws(() => hunspell.removeManySync('npm'))
+    throws(() => hunspell.addManyWithAffixSync([['npm', 1]]))
+  })
+
+  it('should add and remove many words', async () => {
+    await hunspell.addMany(words)
+    deepEqual(Array.from(await hunspell.spellBatch(words)), words.map(() => 1))
+
+    await hunspell.removeMany(words)
+    deepEqual(Array.from(await hunspell.spellBatch(words)), words.map(() => 0))
+
+    hunspell.addManySync(words)
+    deepEqual(Array.from(hunspell.spellBatchSync(words)), words.map(() => 1))
+
+    hunspell.removeManySync(words)
+    deepEqual(Array.from(hunspell.spellBatchSync(words)), words.map(() => 0))
+  })
+
+  it('should add many words with affixes', async () => {
+    await hunspell.addManyWithAffix([['colour', 'color'], ['flavour', 'flavor']])
+    strictEqual(await hunspell.spell('colouring'), true)
+    strictEqual(await hunspell.spell('flavouring'), true)
+
+    hunspell.addManyWithAffixSync([['honour', 'honor']])
+    strictEqual(hunspell.spellSync('honouring'), true)
+  })
+})
+
 describe('Hunspell#analyze(word: string): Promise<string[]>;', () => {
   const hunspell = new Hunspell(enUS.affix, enUS.dictionary)
 
@@ -949,6 +1729,77 @@ describe('Hunspell#stemSync(word: string): string[];', () => {
       []
     )
   })
+
+  it('should decode multi-byte roots', () => {
+    const hunspell = new Hunspell(enUS.affix, enUS.dictionary)
+    hunspell.addWithAffixSync('café', 'cat')
+
+    deepEqual(hunspell.stemSync('cafés'), ['café'])
+  })
+})
+
+describe('Hunspell#stemBatch(words) and analyzeBatch(words)', () => {
+  const hunspell = new Hunspell({ aff: enUS.affix, dic: enUS.dictionary }, { concurrency: 2 })
+  const words = ['telling', 'colour', 'telling', 'color']
+
+  it('should match stemSync() and analyzeSync()', async () => {
+    const stems = words.map((word) => hunspell.stemSync(word))
+    const analyses = words.map((word) => hunspell.analyzeSync(word))
+
+    for (const parallelism of [1, 2]) {
+      deepEqual((await hunspell.stemBatch(words, { parallelism })).toArray(), stems)
+      deepEqual((await hunspell.analyzeBatch(words, { parallelism })).toArray(), analyses)
+    }
+
+    deepEqual(hunspell.stemBatchSync(words).toArray(), stems)
+    deepEqual(hunspell.analyzeBatchSync(words).toArray(), analyses)
+    deepEqual(stems[0], ['telling', 'tell'])
+  })
+
+  it('should accept packed words', async () => {
+    const data = Buffer.from('tellingcolourtelling')
+    const offsets = new Uint32Array([0, 7, 13, 20])
+    const expected = [['telling', 'tell'], [], ['telling', 'tell']]
+
+    deepEqual((await hunspell.stemBatch({ data, offsets })).toArray(), expected)
+    deepEqual(hunspell.stemBatchSync({ data, offsets }).toArray(), expected)
+    strictEqual(hunspell.stemBatchSync({ data, offsets: new Uint32Array([0]) }).length, 0)
+  })
+
+  it('should reject invalid words', async () => {
+    const data = Buffer.from('telling')
+    const invalid = [
+      'telling',
+      [1],
+      { data },
+      { data, offsets: [0, 7] },
+      { data, offsets: new Uint32Array([]) },
+      { data, offsets: new Uint32Array([0, 8]) },
+      { data, offsets: new Uint32Array([4, 2]) }
+    ]
+
+    for (const words of invalid) {
+      throws(() => hunspell.stemBatchSync(words))
+
+      try {
+        await hunspell.analyzeBatch(words)
+        fail()
+      } catch (err) {
+        strictEqual(err.message, 'First argument is invalid.')
+      }
+    }
+
+    throws(() => hunspell.stemBatchSync(words, {}))
+  })
+
+  it('should remember results across batches with cacheSize', async () => {
+    const hunspell = new Hunspell({ aff: enUS.affix, dic: enUS.dictionary }, { cacheSize: 10 })
+
+    await hunspell.stemBatch(words)
+    await hunspell.stemBatch(words)
+
+    deepEqual(hunspell.getCacheStats(), { hits: 3, misses: 3, size: 3, capacity: 10 })
+  })
 })
 
 describe('Hunspell#generate(word: string, example: string): Promise<string[]>;', () => {
@@ -1167,6 +2018,13 @@ describe('Hunspell#addDictionary(dictionary: string): Promise<void>;', () => {
     await hunspell.addDictionary(fr.dictionary)
     strictEqual(await hunspell.spell('bonjour'), true)
   })
+
+  it('should accept a buffer', async () => {
+    const hunspell = new Hunspell(enUS.affix, enUS.dictionary)
+
+    await hunspell.addDictionary(readFileSync(fr.dictionary))
+    strictEqual(await hunspell.spell('bonjour'), true)
+  })
 })
 
 describe('Hunspell#addDictionarySync(dictionary: string): void;', () => {
@@ -1207,6 +2065,13 @@ describe('Hunspell#addDictionarySync(dictionary: string): void;', () => {
     hunspell.addDictionarySync(fr.dictionary)
     strictEqual(hunspell.spellSync('bonjour'), true)
   })
+
+  it('should accept a buffer', () => {
+    const hunspell = new Hunspell(enUS.affix, enUS.dictionary)
+
+    hunspell.addDictionarySync(readFileSync(fr.dictionary))
+    strictEqual(hunspell.spellSync('bonjour'), true)
+  })
 })
 
 describe('Hunspell#addWithAffix(word: string, example: string): Promise<void>;', () => {
@@ -1322,6 +2187,179 @@ describe('Hunspell#addWithAffixSync(word: string, example: string): void;', () =
   })
 })
 
+describe('AbortSignal', () => {
+  const hunspell = new Hunspell(enUS.affix, enUS.dictionary)
+
+  it('should reject when the signal is invalid', async () => {
+    for (const call of [
+      () => hunspell.spell('color', { signal: 1 }),
+      () => hunspell.suggest('colour', { signal: {} }),
+      () => hunspell.generate('told', 'run', 1),
+      () => hunspell.add('npm', 1)
+    ]) {
+      try {
+        await call()
+        fail()
+      } catch (error) {
+        strictEqual(error.name, 'Error')
+      }
+    }
+  })
+
+  it('should reject when the signal was already aborted', async () => {
+    const signal = AbortSignal.abort()
+
+    for (const call of [
+      () => hunspell.spell('color', { signal }),
+      () => hunspell.spellBatch(['color'], { signal }),
+      () => hunspell.checkText('colour', { signal }),
+      () => hunspell.suggest('colour', { signal }),
+      () => hunspell.analyze('color', { signal }),
+      () => hunspell.stem('color', { signal }),
+      () => hunspell.generate('told', 'run', { signal }),
+      () => Hunspell.load({ aff: enUS.affix, dic: enUS.dictionary }, { signal })
+    ]) {
+      try {
+        await call()
+        fail()
+      } catch (error) {
+        strictEqual(error.name, 'AbortError')
+      }
+    }
+  })
+
+  it('should not apply writes when the signal was already aborted', async () => {
+    const signal = AbortSignal.abort()
+
+    try {
+      await hunspell.add('npm', { signal })
+      fail()
+    } catch (error) {
+      strictEqual(error.name, 'AbortError')
+    }
+
+    strictEqual(hunspell.spellSync('npm'), false)
+  })
+
+  it('should reject with the reason when aborted later', async () => {
+    const controller = new AbortController()
+    const promises = Array(20).fill('colour').map(word => hunspell.suggest(word, { signal: controller.signal }))
+
+    controller.abort('stop')
+
+    for (const promise of promises) {
+      try {
+        await promise
+        fail()
+      } catch (error) {
+        strictEqual(error, 'stop')
+      }
+    }
+  })
+
+  it('should resolve when not aborted', async () => {
+    const controller = new AbortController()
+
+    strictEqual(await hunspell.spell('color', { signal: controller.signal }), true)
+    deepEqual(await hunspell.stem('telling', { signal: controller.signal }), ['telling', 'tell'])
+    controller.abort()
+  })
+})
+
+describe('Hunspell.setLoadThreads(threads)', () => {
+  const output = join(tmpdir(), `hunspell-${process.pid}-threads.dic`)
+
+  it('should throw when the number is invalid', () => {
+    throws(() => Hunspell.setLoadThreads())
+    throws(() => Hunspell.setLoadThreads(-1))
+    throws(() => Hunspell.setLoadThreads(1.5))
+    throws(() => Hunspell.setLoadThreads('2'))
+  })
+
+  it('should load the same dictionary with any number of threads', async () => {
+    const compile = async (threads) => {
+      Hunspell.setLoadThreads(threads)
+      await Hunspell.compile({ aff: nl.affix, dic: nl.dictionary }, output)
+      return readFileSync(output)
+    }
+
+    try {
+      const sequential = await compile(1)
+
+      for (const threads of [2, 3, 8]) {
+        deepEqual(await compile(threads), sequential)
+      }
+    } finally {
+      Hunspell.setLoadThreads(0)
+      rmSync(output, { force: true })
+    }
+  })
+})
+
+describe('Hunspell.setThreadPoolSize(size)', () => {
+  const hunspell = new Hunspell({ aff: enUS.affix, dic: enUS.dictionary }, { concurrency: 2 })
+
+  it('should throw when the size is invalid', () => {
+    throws(() => Hunspell.setThreadPoolSize())
+    throws(() => Hunspell.setThreadPoolSize(-1))
+    throws(() => Hunspell.setThreadPoolSize(1.5))
+    throws(() => Hunspell.setThreadPoolSize('2'))
+  })
+
+  it('should run operations on its own threads', async () => {
+    Hunspell.setThreadPoolSize(3)
+
+    try {
+      const words = Array(20).fill(['color', 'colour']).flat()
+      const [results, suggestions, loaded] = await Promise.all([
+        Promise.all(words.map(word => hunspell.spell(word))),
+        Promise.all(words.map(word => hunspell.suggest(word))),
+        Hunspell.load(enUS.affix, enUS.dictionary)
+      ])
+
+      deepEqual(results, words.map(word => word === 'color'))
+      deepEqual(suggestions[1].slice(0, 1), ['color'])
+      strictEqual(await loaded.spell('color'), true)
+
+      await hunspell.add('npm')
+      strictEqual(await hunspell.spell('npm'), true)
+      await hunspell.remove('npm')
+    } finally {
+      Hunspell.setThreadPoolSize(0)
+    }
+  })
+
+  it('should cancel queued operations', async () => {
+    Hunspell.setThreadPoolSize(1)
+
+    try {
+      const controller = new AbortController()
+      const promises = Array(20).fill('colour').map(word => hunspell.suggest(word, { signal: controller.signal }))
+
+      controller.abort()
+
+      for (const promise of promises) {
+        try {
+          await promise
+          fail()
+        } catch (error) {
+          strictEqual(error.name, 'AbortError')
+        }
+      }
+    } finally {
+      Hunspell.setThreadPoolSize(0)
+    }
+  })
+
+  it('should resize', async () => {
+    Hunspell.setThreadPoolSize(4)
+    Hunspell.setThreadPoolSize(1)
+    strictEqual(await hunspell.spell('color'), true)
+    Hunspell.setThreadPoolSize(0)
+    strictEqual(await hunspell.spell('color'), true)
+  })
+})
+
 describe('Hunspell#getWordCharacters()', () => {
   const hunspell = new Hunspell(enUS.affix, enUS.dictionary)
   const hunspellGB = new Hunspell(enGB.affix, enGB.dictionary)
@@ -1334,3 +2372,123 @@ describe('Hunspell#getWordCharacters()', () => {
     strictEqual(hunspellGB.getWordCharacters(), undefined)
   })
 })
+
+describe('Hunspell#stats()', () => {
+  const operations = ['spell', 'suggest', 'analyze', 'stem', 'generate', 'add', 'remove']
+
+  it('should throw when arguments are given', () => {
+    throws(() => new Hunspell(enUS.affix, enUS.dictionary).stats(1))
+  })
+
+  it('should report the memory of each structure', () => {
+    const { memory, memoryByStructure } = new Hunspell(
+      { aff: enUS.affix, dic: enUS.dictionary },
+      { suggestIndex: true, wordStore: true }
+    ).stats()
+
+    strictEqual(memoryByStructure.hashTables > 0, true)
+    strictEqual(memoryByStructure.entries > 0, true)
+    strictEqual(memoryByStructure.descriptions > 0, true)
+    strictEqual(memoryByStructure.suggestIndex > 0, true)
+    strictEqual(memoryByStructure.wordStore > 0, true)
+    strictEqual(
+      memory,
+      memoryByStructure.instances + memoryByStructure.hashTables + memoryByStructure.entries +
+        memoryByStructure.descriptions + memoryByStructure.suggestIndex + memoryByStructure.wordStore
+    )
+  })
+
+  it('should store each description once', () => {
+    const load = (count) => {
+      const words = Array.from({ length: count }, (_, i) => `word${i} po:noun`)
+      return new Hunspell({ aff: Buffer.from('SET UTF-8\n'), dic: Buffer.from(`${count}\n${words.join('\n')}\n`) })
+    }
+
+    const few = load(10)
+    const many = load(1000)
+
+    deepEqual(many.analyzeSync('word999'), [' st:word999 po:noun'])
+    strictEqual(many.stats().memoryByStructure.descriptions, few.stats().memoryByStructure.descriptions)
+  })
+
+  it('should start empty', () => {
+    const stats = new Hunspell(enUS.affix, enUS.dictionary).stats()
+
+    strictEqual(typeof stats.memory, 'number')
+    strictEqual(stats.memoryByStructure.suggestIndex, 0)
+    strictEqual(stats.memoryByStructure.wordStore, 0)
+    deepEqual(Object.keys(stats.operations), operations)
+
+    for (const operation of operations) {
+      const { calls, inFlight, queueWait, execute, lockWait } = stats.operations[operation]
+
+      strictEqual(calls, 0)
+      strictEqual(inFlight, 0)
+
+      for (const histogram of [queueWait, execute, lockWait]) {
+        deepEqual(histogram, { count: 0, sum: 0, max: 0, p50: 0, p90: 0, p99: 0, p999: 0, buckets: [] })
+      }
+    }
+  })
+
+  it('should count calls', async () => {
+    const hunspell = new Hunspell(enUS.affix, enUS.dictionary)
+
+    hunspell.spellSync('color')
+    await hunspell.spell('color')
+    await hunspell.checkText('colour')
+    await hunspell.suggest('colour')
+    hunspell.addSync('npm')
+    await hunspell.addMany(['npx', 'nvm'])
+    await hunspell.remove('npm')
+
+    const { spell, suggest, add, remove, stem } = hunspell.stats().operations
+
+    strictEqual(spell.calls, 3)
+    strictEqual(spell.lockWait.count, 3)
+    strictEqual(spell.queueWait.count, 2)
+    strictEqual(spell.execute.count, 2)
+    strictEqual(suggest.calls, 1)
+    strictEqual(add.calls, 2)
+    strictEqual(add.execute.count, 1)
+    strictEqual(remove.calls, 1)
+    strictEqual(stem.calls, 0)
+  })
+
+  it('should count a call per unique word of a batch', async () => {
+    const hunspell = new Hunspell({ aff: enUS.affix, dic: enUS.dictionary }, { concurrency: 2 })
+
+    await hunspell.stemBatch(['colored', 'colors', 'colored'], { parallelism: 2 })
+    await hunspell.analyzeBatch(['colored'])
+    hunspell.stemBatchSync(['colors'])
+
+    const { stem, analyze } = hunspell.stats().operations
+
+    strictEqual(stem.calls, 3)
+    strictEqual(analyze.calls, 1)
+  })
+
+  it('should count asynchronous calls in flight', async () => {
+    const hunspell = new Hunspell(enUS.affix, enUS.dictionary)
+    const promise = hunspell.suggest('colour')
+
+    strictEqual(hunspell.stats().operations.suggest.inFlight, 1)
+    await promise
+    strictEqual(hunspell.stats().operations.suggest.inFlight, 0)
+  })
+
+  it('should record durations in buckets', async () => {
+    const hunspell = new Hunspell(enUS.affix, enUS.dictionary)
+
+    await hunspell.suggest('colour')
+    await hunspell.suggest('behaviour')
+
+    const { execute } = hunspell.stats().operations.suggest
+
+    strictEqual(execute.count, 2)
+    strictEqual(execute.buckets.reduce((total, [, count]) => total + count, 0), 2)
+    strictEqual(execute.max > 0, true)
+    strictEqual(execute.p50 <= execute.p99 && execute.p99 <= execute.max, true)
+    strictEqual(execute.sum >= execute.max, true)
+  })
+})